@@ -80,6 +80,8 @@ struct timespec
     /* .timer_info         */ (TIMER_INFO_ADDRESS),  \
     /* .on_tick            */ (NULL),                \
     /* .user_data          */ (NULL),                \
+    /* .slack              */ (0),                   \
+    /* .paused_ticks       */ (0),                   \
 }                                                  /*;*/
 
 
@@ -118,6 +120,41 @@ typedef enum
 }software_timer_duration_flag_t;
 
 
+//! @brief Return values of the validation of the hardware timer data, see ::software_timer_timer_info_init()
+typedef enum
+{
+    //! The data of the hardware timer is valid
+    SOFTWARE_TIMER_TIMER_INFO_FLAG_VALID                  = 0x00,
+
+    //! The address ::software_timer_timer_info_s::counter is `NULL`
+    SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_COUNTER             = 0x01,
+
+    //! The address ::software_timer_timer_info_s::overflows is `NULL`
+    SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_OVERFLOWS           = 0x02,
+
+    //! The value ::software_timer_timer_info_s::ticks_per_second is `0`, no time can be calculated
+    SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_TICKS_PER_SECOND    = 0x04,
+
+    //! The value ::software_timer_timer_info_s::ticks_per_second does not fit into 32 bits,
+    //! the conversion into nanoseconds uses a slow division
+    SOFTWARE_TIMER_TIMER_INFO_FLAG_SLOW_NS_CONVERSION     = 0x08,
+}software_timer_timer_info_flag_t;
+
+
+//! @brief Handling of missed expiries of a periodic timer, see ::software_timer_resync()
+typedef enum
+{
+    //! The missed expiries are skipped, the timer expires next on its period after the current time
+    SOFTWARE_TIMER_RESYNC_POLICY_SKIP       = 0x00,
+
+    //! The missed expiries are combined, the timer expires once at the next check
+    SOFTWARE_TIMER_RESYNC_POLICY_FIRE_ONCE  = 0x01,
+
+    //! The timer is not changed, only the number of missed expiries is determined
+    SOFTWARE_TIMER_RESYNC_POLICY_REPORT     = 0x02,
+}software_timer_resync_policy_t;
+
+
 //! @brief The object data of the hardware timer
 typedef struct software_timer_timer_info_s
 {
@@ -143,12 +180,56 @@ typedef struct software_timer_timer_info_s
     //! by multiplying this value and the ::software_timer_timer_info_s::prescaler
     uint64_t ticks_per_second;
 
-    //! @brief This is the inverse value of ::software_timer_timer_info_s::ticks_per_second
+    //! @brief This is the inverse value of ::software_timer_timer_info_s::ticks_per_second,
+    //! is calculated by ::software_timer_timer_info_init()
     double seconds_per_tick;
 
-    //! @brief This is the inverse value of (::software_timer_timer_info_s::capture_compare + 1)
+    //! @brief This is the inverse value of (::software_timer_timer_info_s::capture_compare + 1),
+    //! is calculated by ::software_timer_timer_info_init()
     double capture_compare_inverse;
 
+    //! @brief Number of ticks per overflow (::software_timer_timer_info_s::capture_compare + 1),
+    //! is calculated by ::software_timer_timer_info_init()
+    uint32_t period;
+
+    //! @brief `true` if ::software_timer_timer_info_s::period is a power of two, then
+    //! ::software_timer_timer_info_s::period_mask and ::software_timer_timer_info_s::period_shift are used
+    bool period_is_power_of_two;
+
+    //! @brief Mask of the ticks within one overflow, `period - 1` if the period is a power of two
+    uint32_t period_mask;
+
+    //! @brief Logarithm to base two of the period, if the period is a power of two
+    uint8_t period_shift;
+
+    //! @brief Multiplier to divide ticks by ::software_timer_timer_info_s::period,
+    //! is calculated by ::software_timer_timer_info_init()
+    //! @details `overflows = (ticks * overflows_mult) >> (64 + overflows_shift)`, the
+    //! result is corrected afterwards so that the division is exact.
+    uint64_t overflows_mult;
+
+    //! @brief Shift of ::software_timer_timer_info_s::overflows_mult
+    uint8_t overflows_shift;
+
+    //! @brief Multiplier to divide ticks by ::software_timer_timer_info_s::ticks_per_second,
+    //! is calculated by ::software_timer_timer_info_init()
+    //! @details `seconds = (ticks * seconds_mult) >> (64 + seconds_shift)`, the
+    //! result is corrected afterwards so that the division is exact.
+    uint64_t seconds_mult;
+
+    //! @brief Shift of ::software_timer_timer_info_s::seconds_mult
+    uint8_t seconds_shift;
+
+    //! @brief Multiplier to convert the ticks of a fraction of a second into nanoseconds,
+    //! is calculated by ::software_timer_timer_info_init()
+    //! @details `nanoseconds = (ticks * nanoseconds_mult) >> nanoseconds_shift`, the
+    //! result is corrected afterwards so that the conversion is exact. The value is `0`
+    //! if ::software_timer_timer_info_s::ticks_per_second does not fit into 32 bits.
+    uint32_t nanoseconds_mult;
+
+    //! @brief Shift of ::software_timer_timer_info_s::nanoseconds_mult
+    uint8_t nanoseconds_shift;
+
 } software_timer_timer_info_t;
 
 
@@ -199,6 +280,14 @@ typedef struct software_timer_s
     //! @brief Optional pointer to user data, `NULL` is allowed
     void * user_data;
 
+    //! @brief Tolerance window in ticks by which the timer may expire later, `0` if not used
+    //! @details See ::software_timer_set_slack()
+    uint32_t slack;
+
+    //! @brief Remaining ticks plus one while the timer is paused, `0` if not paused
+    //! @details See ::software_timer_pause()
+    uint64_t paused_ticks;
+
 }software_timer_t;
 
 
@@ -225,20 +314,44 @@ struct software_timer_sc
 {
     software_timer_duration_flag_t (*CalculateAndSetDuration) (software_timer_t * object, double time_in_seconds);
     software_timer_duration_flag_t (*CalculateDuration) (const software_timer_timer_info_t * const timer_info, double time_in_seconds, software_timer_duration_t * duration);
+    uint64_t (*ConvertTicks) (uint64_t ticks, const software_timer_timer_info_t * from, const software_timer_timer_info_t * to);
     bool (*Elapsed) (software_timer_t *object);
     bool (*ElapsedOnce) (software_timer_t *object);
     bool (*ElapsedPreventMultipleTriggers) (software_timer_t *object);
+    bool (*Expire) (software_timer_t * object);
+    uint64_t (*GetDeadlineTicks) (const software_timer_t * object);
     void (*GetDuration) (const software_timer_t * object, software_timer_duration_t * duration);
+    uint64_t (*GetEndTicks) (const software_timer_t * object);
+    uint64_t (*GetNs) (const software_timer_timestamp_t * timestamp);
+    uint64_t (*GetTicks) (const software_timer_timestamp_t * timestamp);
     double (*GetTime) (const software_timer_timestamp_t * timestamp);
     void (*GetTimespec) (const software_timer_timestamp_t * timestamp, struct timespec * result_timespec);
+    void (*GetTimespecInteger) (const software_timer_timestamp_t * timestamp, struct timespec * result_timespec);
     void (*GetTimestamp) (const software_timer_t * object, software_timer_timestamp_t * timestamp);
     void (*InitHalt) (software_timer_t * object, const software_timer_timer_info_t * const timer_info);
+    bool (*IsPaused) (const software_timer_t * object);
     bool (*IsRunning) (const software_timer_t * object);
     bool (*IsStopped) (const software_timer_t * object);
+    bool (*Pause) (software_timer_t * object);
+    bool (*PauseAt) (software_timer_t * object, const software_timer_timestamp_t * timestamp);
+    bool (*Rescale) (software_timer_t * object, const software_timer_timer_info_t * timer_info);
+    bool (*Restart) (software_timer_t * object);
+    bool (*Resume) (software_timer_t * object);
+    bool (*ResumeAt) (software_timer_t * object, const software_timer_timestamp_t * timestamp);
+    uint64_t (*Resync) (software_timer_t * object, software_timer_resync_policy_t policy);
+    uint64_t (*ResyncAt) (software_timer_t * object, const software_timer_timestamp_t * timestamp, software_timer_resync_policy_t policy);
     void (*SetDuration) (software_timer_t * object, const software_timer_duration_t * duration);
+    void (*SetSlack) (software_timer_t * object, uint32_t slack);
+    void (*SetTicks) (software_timer_timestamp_t * timestamp, uint64_t ticks);
     void (*Start) (software_timer_t *object);
+    void (*StartAligned) (software_timer_t * object, uint64_t period_boundary);
+    void (*StartAt) (software_timer_t * object, const software_timer_timestamp_t * timestamp);
+    void (*StartBatch) (software_timer_t * timers, uint32_t count);
+    void (*StartBatchAt) (software_timer_t * timers, uint32_t count, const software_timer_timestamp_t * timestamp);
     void (*Stop) (software_timer_t *object);
     void (*SubTimestamp) (software_timer_timestamp_t * result_and_minuend, const software_timer_timestamp_t * subtrahend);
+    void (*TimerInfoGetTimestamp) (const software_timer_timer_info_t * timer_info, software_timer_timestamp_t * timestamp);
+    software_timer_timer_info_flag_t (*TimerInfoInit) (software_timer_timer_info_t * timer_info);
 };
 
 
@@ -266,12 +379,26 @@ software_timer_duration_flag_t software_timer_calculate_and_set_duration (softwa
 
 //! @brief Calculates the duration of the specified timer object according to the specified time
 //!
+//! @details The hardware timer data must be initialized with ::software_timer_timer_info_init().
+//!
 //! @param[in] timer_info Pointer to the data of the hardware timer
 //! @param time_in_seconds The time after which the timer expires
 //! @param[out] duration Duration data based on the hardware timer used and the specified time
 //! @return Returns the flags with information about the calculated duration
 software_timer_duration_flag_t software_timer_calculate_duration (const software_timer_timer_info_t * const timer_info, double time_in_seconds, software_timer_duration_t * duration);
 
+//! @brief Converts a number of ticks from one tick frequency to another
+//!
+//! @details The same time is calculated with integer arithmetic and a 128-bit intermediate
+//! result, the result is rounded up as with ::software_timer_calculate_duration().
+//!
+//! @param ticks The number of ticks with the frequency of `from`
+//! @param[in] from Pointer to the data of the hardware timer of `ticks`
+//! @param[in] to Pointer to the data of the hardware timer of the result
+//! @return Returns the number of ticks with the frequency of `to`, `0` if a frequency is `0`,
+//! `UINT64_MAX` if the result does not fit into 64 bits
+uint64_t software_timer_convert_ticks (uint64_t ticks, const software_timer_timer_info_t * from, const software_timer_timer_info_t * to);
+
 //! @brief  Checks if the timer is elapsed
 //!
 //! @details The handler assigned to the function pointer ::software_timer_t::tick is called.
@@ -316,12 +443,58 @@ bool software_timer_elapsed_once (software_timer_t *object);
 //! @retval false if the timer has not yet expired
 bool software_timer_elapsed_prevent_multiple_triggers (software_timer_t *object);
 
+//! @brief Calls the handler and restarts the timer with its last end value without checking the time
+//!
+//! @details It does the same as ::software_timer_elapsed() for a due timer. A scheduler can use it
+//! to expire a timer within its tolerance window, see ::software_timer_set_slack().
+//!
+//! @param[in,out] object The software timer object
+//! @retval true  when the timer has expired
+//! @retval false if the timer is stopped
+bool software_timer_expire (software_timer_t * object);
+
+//! @brief Gets the ticks at which the timer expires, including the slack
+//!
+//! @details A scheduler can wait until the smallest value of all timers and then
+//! check all timers in one pass, see ::software_timer_set_slack().
+//!
+//! @param[in] object The software timer object
+//! @return Returns the ticks, see ::software_timer_get_ticks(), `UINT64_MAX` if the timer is stopped
+uint64_t software_timer_get_deadline_ticks (const software_timer_t * object);
+
 //! @brief Gets the duration data of the software timer object
 //!
 //! @param[in] object The software timer object
 //! @param[out] duration Duration data based on the hardware timer used and the specified time
 void software_timer_get_duration (const software_timer_t * object, software_timer_duration_t * duration);
 
+//! @brief Gets the ticks of the end value of the timer, without the slack
+//!
+//! @param[in] object The software timer object
+//! @return Returns the ticks, see ::software_timer_get_ticks(), `UINT64_MAX` if the timer is stopped
+uint64_t software_timer_get_end_ticks (const software_timer_t * object);
+
+//! @brief Converts the timestamp value into nanoseconds using integer arithmetic only
+//!
+//! @details The conversion uses the multipliers of ::software_timer_timer_info_init() and
+//! is exact, the result is rounded down to whole nanoseconds. The result is valid as long
+//! as the ticks fit into 64 bits, see ::software_timer_get_ticks(), and the nanoseconds do
+//! not exceed `UINT64_MAX`, which corresponds to approx. 584 years.
+//!
+//! @param[in] timestamp Pointer to the timer values
+//! @return Returns the time in nanoseconds
+uint64_t software_timer_get_ns (const software_timer_timestamp_t * timestamp);
+
+//! @brief Converts the timestamp value into the number of ticks
+//!
+//! @details The ticks are calculated with `overflows * period + counter`, if the
+//! period is a power of two, a shift is used. With 42.5 MHz, 64 bits are sufficient
+//! for approx. 13,700 years. The inverse function is ::software_timer_set_ticks().
+//!
+//! @param[in] timestamp Pointer to the timer values
+//! @return Returns the number of ticks
+uint64_t software_timer_get_ticks (const software_timer_timestamp_t * timestamp);
+
 //! @brief Converts the timestamp value into a seconds value
 //!
 //! @param[in] timestamp Pointer to the timer values
@@ -334,6 +507,15 @@ double software_timer_get_time (const software_timer_timestamp_t * timestamp);
 //! @param[out] result_timespec Standard ::timespec struct.
 void software_timer_get_timespec (const software_timer_timestamp_t * timestamp, struct timespec * result_timespec);
 
+//! @brief Converts the timestamp to the standard structure timespec using integer arithmetic only
+//!
+//! @details In contrast to ::software_timer_get_timespec() no precision is lost, see
+//! ::software_timer_get_ns() for the preconditions.
+//!
+//! @param[in] timestamp of the software timer.
+//! @param[out] result_timespec Standard ::timespec struct.
+void software_timer_get_timespec_integer (const software_timer_timestamp_t * timestamp, struct timespec * result_timespec);
+
 //! @brief Reads the current values of the underlying timer
 //!
 //! @param[in] object The software timer object
@@ -346,6 +528,13 @@ void software_timer_get_timestamp (const software_timer_t * object, software_tim
 //! @param[in] timer_info Address of the underlying hardware timer
 void software_timer_init_halt (software_timer_t * object, const software_timer_timer_info_t * const timer_info);
 
+//! @brief Checks if the timer is paused, see ::software_timer_pause()
+//!
+//! @param[in] object The software timer object
+//! @retval true  when the timer is paused
+//! @retval false if the timer is running or stopped
+bool software_timer_is_paused (const software_timer_t * object);
+
 //! @brief Checks if the timer is running
 //!
 //! @param[in] object The software timer object
@@ -360,17 +549,165 @@ bool software_timer_is_running (const software_timer_t * object);
 //! @retval false if the timer is running
 bool software_timer_is_stopped (const software_timer_t * object);
 
+//! @brief Pauses the timer and keeps the remaining time until it expires
+//!
+//! @details A paused timer is stopped, see ::software_timer_is_stopped(), and can be
+//! continued with ::software_timer_resume(). The slack is not included in the remaining
+//! time. If the timer has already expired, it expires immediately after resuming.
+//! Starting or stopping the timer discards the remaining time.
+//!
+//! @param[in,out] object The software timer object
+//! @retval true  when the timer was paused
+//! @retval false if the timer is not running
+bool software_timer_pause (software_timer_t * object);
+
+//! @brief Pauses the timer at the specified time instead of the current time
+//!
+//! @details Can be used to pause many timers with one read of the hardware timer,
+//! see ::software_timer_pause().
+//!
+//! @param[in,out] object The software timer object
+//! @param[in] timestamp The current time, e.g. of ::software_timer_get_timestamp()
+//! @retval true  when the timer was paused
+//! @retval false if the timer is not running
+bool software_timer_pause_at (software_timer_t * object, const software_timer_timestamp_t * timestamp);
+
+//! @brief Changes the hardware timer of a stopped or paused timer, e.g. after a change of the prescaler
+//!
+//! @details The duration and the remaining time of a paused timer are converted to the new
+//! tick frequency with ::software_timer_convert_ticks(), so the time in seconds is kept.
+//! A running timer must be paused first, see ::software_timer_pause(). If the duration or the
+//! remaining time does not fit into 64 bits of the new tick frequency, the timer is not changed.
+//!
+//! @param[in,out] object The software timer object
+//! @param[in] timer_info Pointer to the data of the new hardware timer
+//! @retval true  when the timer was changed
+//! @retval false if the timer is running or the converted time does not fit
+bool software_timer_rescale (software_timer_t * object, const software_timer_timer_info_t * timer_info);
+
+//! @brief Restarts a running timer with its last end value, as ::software_timer_elapsed() after an expiry
+//!
+//! @details The duration is added to the end value, so a periodic timer does not drift.
+//! Can be used to restart expired timers without calling their handler.
+//!
+//! @param[in,out] object The software timer object
+//! @retval true  when the timer was restarted
+//! @retval false if the timer is stopped
+bool software_timer_restart (software_timer_t * object);
+
+//! @brief Continues a paused timer with the remaining time
+//!
+//! @param[in,out] object The software timer object
+//! @retval true  when the timer was resumed
+//! @retval false if the timer is not paused
+bool software_timer_resume (software_timer_t * object);
+
+//! @brief Continues a paused timer at the specified time instead of the current time
+//!
+//! @details Can be used to resume many timers with one read of the hardware timer,
+//! see ::software_timer_resume().
+//!
+//! @param[in,out] object The software timer object
+//! @param[in] timestamp The current time, e.g. of ::software_timer_get_timestamp()
+//! @retval true  when the timer was resumed
+//! @retval false if the timer is not paused
+bool software_timer_resume_at (software_timer_t * object, const software_timer_timestamp_t * timestamp);
+
+//! @brief Moves the deadline of a periodic timer past the current time, e.g. after a sleep
+//!
+//! @details After a large jump of the overflows, ::software_timer_elapsed() would expire once for
+//! each missed period. The deadline is moved forward by a whole number of durations in one
+//! step with integer arithmetic, so that the timer stays on its period. The slack is not included.
+//!
+//! @param[in,out] object The software timer object
+//! @param policy Handling of the missed expiries
+//! @return Returns the number of missed expiries, `0` if the timer is not running or not due
+uint64_t software_timer_resync (software_timer_t * object, software_timer_resync_policy_t policy);
+
+//! @brief Resynchronises the timer at the specified time instead of the current time
+//!
+//! @details Can be used to resynchronise many timers with one read of the hardware timer,
+//! see ::software_timer_resync().
+//!
+//! @param[in,out] object The software timer object
+//! @param[in] timestamp The current time, e.g. of ::software_timer_get_timestamp()
+//! @param policy Handling of the missed expiries
+//! @return Returns the number of missed expiries, `0` if the timer is not running or not due
+uint64_t software_timer_resync_at (software_timer_t * object, const software_timer_timestamp_t * timestamp, software_timer_resync_policy_t policy);
+
 //! @brief Sets the duration data of the software timer object
 //!
 //! @param[in,out] object The software timer object
 //! @param[in] duration Duration data based on the hardware timer used and the specified time
 void software_timer_set_duration (software_timer_t * object, const software_timer_duration_t * duration);
 
+//! @brief Sets the tolerance window in ticks by which the timer may expire later
+//!
+//! @details Similar to the Linux `timer_slack_ns`, the deadline is moved within the
+//! window `[deadline, deadline + slack]` to the value with the most trailing zero bits.
+//! Each deadline is rounded on its own, ::software_timer_elapsed() expires the timer at the
+//! rounded value. A pool expires all timers whose deadline without slack has passed at the
+//! next wakeup, see ::software_timer_pool_poll(), so timers inside their window are handled
+//! together with an earlier one. The interval of a periodic timer is retained, only the
+//! individual expiry is delayed. A value of `0` disables the slack.
+//!
+//! @param[in,out] object The software timer object
+//! @param slack The tolerance window in ticks
+void software_timer_set_slack (software_timer_t * object, uint32_t slack);
+
+//! @brief Sets the timestamp values from a number of ticks, see ::software_timer_get_ticks()
+//!
+//! @details The division by the period uses the multiplier of ::software_timer_timer_info_init(),
+//! or a shift and mask if the period is a power of two.
+//!
+//! @param[in,out] timestamp Timestamp whose ::software_timer_timestamp_s::timer_info must be set
+//! @param ticks The number of ticks
+void software_timer_set_ticks (software_timer_timestamp_t * timestamp, uint64_t ticks);
+
 //! @brief Starts the timer
 //!
 //! @param[in,out] object The software timer object
 void software_timer_start (software_timer_t *object);
 
+//! @brief Starts the timer so that it first expires on the next multiple of a tick boundary
+//!
+//! @details The first expiry is the smallest multiple of `period_boundary` ticks that is greater
+//! than the current ticks, see ::software_timer_get_ticks(). Afterwards the timer runs with its
+//! duration as usual, so with a duration that is a multiple of the boundary all expiries stay aligned.
+//! If `period_boundary` is 0, the function behaves like ::software_timer_start().
+//!
+//! @param[in,out] object The software timer object
+//! @param period_boundary The boundary in ticks
+void software_timer_start_aligned (software_timer_t * object, uint64_t period_boundary);
+
+//! @brief Starts the timer with an absolute deadline
+//!
+//! @details The timer first expires when the hardware timer reaches `timestamp`, afterwards it
+//! runs with its duration as usual. A deadline in the past expires at the next check.
+//!
+//! @param[in,out] object The software timer object
+//! @param[in] timestamp The deadline, e.g. of ::software_timer_set_ticks()
+void software_timer_start_at (software_timer_t * object, const software_timer_timestamp_t * timestamp);
+
+//! @brief Starts several timers with one read of the hardware timer
+//!
+//! @details All timers are started at exactly the same time, so that timers with the
+//! same duration are phase-aligned. All timers must use the same hardware timer.
+//!
+//! @param[in,out] timers Array of software timer objects
+//! @param count Number of elements of `timers`
+void software_timer_start_batch (software_timer_t * timers, uint32_t count);
+
+//! @brief Starts several timers at the specified time instead of the current time
+//!
+//! @details The end value of each timer is `timestamp` plus its duration, see
+//! ::software_timer_start_batch().
+//!
+//! @param[in,out] timers Array of software timer objects
+//! @param count Number of elements of `timers`
+//! @param[in] timestamp The start time, e.g. of ::software_timer_get_timestamp()
+void software_timer_start_batch_at (software_timer_t * timers, uint32_t count, const software_timer_timestamp_t * timestamp);
+
 //! @brief Stops the software timer
 //!
 //! @param[in,out] object The software timer object
@@ -382,6 +719,26 @@ void software_timer_stop (software_timer_t *object);
 //! @param[in] subtrahend Subtrahend
 void software_timer_sub_timestamp (software_timer_timestamp_t * result_and_minuend, const software_timer_timestamp_t * subtrahend);
 
+//! @brief Reads the current values of the hardware timer
+//!
+//! @details Same as ::software_timer_get_timestamp(), but without a software timer object.
+//!
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param[out] timestamp Pointer to the structure in which the values are to be saved
+void software_timer_timer_info_get_timestamp (const software_timer_timer_info_t * timer_info, software_timer_timestamp_t * timestamp);
+
+//! @brief Validates the hardware timer data and calculates all derived values
+//!
+//! @details Must be called once before the hardware timer data is used by any other
+//! function, and again whenever ::software_timer_timer_info_s::capture_compare or
+//! ::software_timer_timer_info_s::ticks_per_second changes. The values
+//! ::software_timer_timer_info_s::seconds_per_tick and
+//! ::software_timer_timer_info_s::capture_compare_inverse are overwritten.
+//!
+//! @param[in,out] timer_info Pointer to the data of the hardware timer
+//! @return Returns the flags with information about the hardware timer data
+software_timer_timer_info_flag_t software_timer_timer_info_init (software_timer_timer_info_t * timer_info);
+
 
 /*---------------------------------------------------------------------*
  *  public: static inline functions
@@ -393,7 +750,7 @@ void software_timer_sub_timestamp (software_timer_timestamp_t * result_and_minue
 //! @return Maximum seconds
 INLINE double SOFTWARE_TIMER_MAX_SECONDS(software_timer_timer_info_t * timer_info)
 {
-    return timer_info->seconds_per_tick * (((uint32_t)(timer_info->capture_compare)) + 1) * (double)UINT64_MAX;
+    return timer_info->seconds_per_tick * timer_info->period * (double)UINT64_MAX;
 }
 
 
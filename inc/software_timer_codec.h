@@ -0,0 +1,167 @@
+//! @file
+//! @brief The software_timer_codec header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A compact stream format for timestamps, e.g. of an event log. A timestamp is stored as
+//! ticks, see ::software_timer_get_ticks(), as zigzag varint difference to the previous
+//! timestamp, so closely spaced events need one to three bytes instead of a full
+//! ::software_timer_timestamp_t. Every `keyframe_interval` timestamps an absolute value
+//! is stored, its position is kept in an index so that reading can start there.
+
+
+#ifndef INC_SOFTWARE_TIMER_CODEC_H_
+#define INC_SOFTWARE_TIMER_CODEC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include <stddef.h>
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The object data of a timestamp stream
+typedef struct software_timer_codec_s
+{
+    //! @brief Pointer to the data of the hardware timer of the timestamps
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief The stream, provided by the user
+    uint8_t * buffer;
+
+    //! @brief Number of bytes of ::software_timer_codec_s::buffer
+    size_t capacity;
+
+    //! @brief Number of bytes of the stream
+    size_t size;
+
+    //! @brief Read position
+    size_t position;
+
+    //! @brief Number of timestamps from one keyframe to the next, at least 1
+    uint32_t keyframe_interval;
+
+    //! @brief Storage of the positions of the keyframes, provided by the user, `NULL` is allowed
+    size_t * keyframes;
+
+    //! @brief Number of elements of ::software_timer_codec_s::keyframes
+    uint32_t keyframes_capacity;
+
+    //! @brief Number of keyframes in the stream, also if they do not fit into the index
+    uint32_t keyframes_count;
+
+    //! @brief Number of written timestamps
+    uint64_t count;
+
+    //! @brief Ticks of the last written timestamp
+    uint64_t write_ticks;
+
+    //! @brief Number of read timestamps
+    uint64_t read_count;
+
+    //! @brief Ticks of the last read timestamp
+    uint64_t read_ticks;
+
+}software_timer_codec_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_codec can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_codec_sc
+{
+    void (*Init) (software_timer_codec_t * codec, const software_timer_timer_info_t * timer_info, uint8_t * buffer, size_t capacity, uint32_t keyframe_interval, size_t * keyframes, uint32_t keyframes_capacity);
+    bool (*Open) (software_timer_codec_t * codec, size_t size);
+    bool (*Read) (software_timer_codec_t * codec, software_timer_timestamp_t * timestamp);
+    bool (*Seek) (software_timer_codec_t * codec, uint32_t keyframe);
+    bool (*Write) (software_timer_codec_t * codec, const software_timer_timestamp_t * timestamp);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_codec_s
+extern const struct software_timer_codec_sc software_timer_codec;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Initializes an empty stream
+//!
+//! @param[out] codec The stream
+//! @param[in] timer_info Pointer to the data of the hardware timer of the timestamps
+//! @param[in] buffer Storage of the stream
+//! @param capacity Number of bytes of `buffer`
+//! @param keyframe_interval Number of timestamps from one keyframe to the next, `0` is treated as `1`
+//! @param[in] keyframes Storage of the index of the keyframes, `NULL` if not required
+//! @param keyframes_capacity Number of elements of `keyframes`
+void software_timer_codec_init (software_timer_codec_t * codec, const software_timer_timer_info_t * timer_info, uint8_t * buffer, size_t capacity, uint32_t keyframe_interval, size_t * keyframes, uint32_t keyframes_capacity);
+
+//! @brief Takes over a stream that is already in the buffer, e.g. read from a file
+//!
+//! @details The stream is scanned once to count the timestamps and to rebuild the index of
+//! the keyframes, further timestamps can be appended afterwards. The stream must have been
+//! written with the same keyframe interval.
+//!
+//! @param[in,out] codec The stream initialized with ::software_timer_codec_init()
+//! @param size Number of bytes of the stream
+//! @retval true  when the stream is complete
+//! @retval false if the stream is larger than the buffer or ends within a timestamp
+bool software_timer_codec_open (software_timer_codec_t * codec, size_t size);
+
+//! @brief Reads the next timestamp
+//!
+//! @param[in,out] codec The stream
+//! @param[out] timestamp The timestamp, ::software_timer_timestamp_s::timer_info is set as well
+//! @retval true  when a timestamp was read
+//! @retval false at the end of the stream
+bool software_timer_codec_read (software_timer_codec_t * codec, software_timer_timestamp_t * timestamp);
+
+//! @brief Continues reading at a keyframe
+//!
+//! @details The next read timestamp is the one with the number `keyframe * keyframe_interval`.
+//! `Seek(codec, 0)` starts reading from the beginning.
+//!
+//! @param[in,out] codec The stream
+//! @param keyframe The number of the keyframe
+//! @retval true  when the read position was changed
+//! @retval false if the keyframe is not in the index
+bool software_timer_codec_seek (software_timer_codec_t * codec, uint32_t keyframe);
+
+//! @brief Appends a timestamp
+//!
+//! @param[in,out] codec The stream
+//! @param[in] timestamp The timestamp
+//! @retval true  when the timestamp was appended
+//! @retval false if the stream is full, nothing was appended
+bool software_timer_codec_write (software_timer_codec_t * codec, const software_timer_timestamp_t * timestamp);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_CODEC_H_ */
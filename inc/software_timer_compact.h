@@ -0,0 +1,205 @@
+//! @file
+//! @brief The software_timer_compact header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A compact timer only stores the deadline and the period as ticks and a
+//! user-defined 32-bit handle, in total 16 bytes. The data of the hardware
+//! timer and the handler are held once per pool. This makes the module
+//! suitable for very large numbers of timers, e.g. connection timeouts.
+
+
+#ifndef INC_SOFTWARE_TIMER_COMPACT_H_
+#define INC_SOFTWARE_TIMER_COMPACT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+//! @brief Deadline of a stopped compact timer
+#define SOFTWARE_TIMER_COMPACT_STOPPED (UINT64_MAX)
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief Forward declaration
+struct software_timer_compact_pool_s;
+
+//! @brief Forward typedef, for information see ::software_timer_compact_pool_s
+typedef struct software_timer_compact_pool_s software_timer_compact_pool_t;
+
+
+//! @brief The object data of the compact software timer
+typedef struct software_timer_compact_s
+{
+    //! @brief Ticks which must be reached for the timer to expire, see ::software_timer_get_ticks(),
+    //! ::SOFTWARE_TIMER_COMPACT_STOPPED if the timer is stopped
+    uint64_t deadline;
+
+    //! @brief The duration in ticks after which the timer expires
+    uint32_t period;
+
+    //! @brief User-defined handle or index, e.g. of a connection
+    uint32_t handle;
+
+}software_timer_compact_t;
+
+
+//! @brief Function pointer type as a handler that is called after a compact timer has expired
+//!
+//! @param[in,out] pool The pool of the timer
+//! @param[in,out] timer The expired timer
+typedef void (*software_timer_compact_handler_t)(software_timer_compact_pool_t * pool, software_timer_compact_t * timer);
+
+
+//! @brief The object data of a pool of compact software timers
+typedef struct software_timer_compact_pool_s
+{
+    //! @brief Storage of the timers, provided by the user
+    software_timer_compact_t * timers;
+
+    //! @brief Number of elements of ::software_timer_compact_pool_s::timers
+    uint32_t capacity;
+
+    //! @brief Number of timers in use, they are stored without gaps at the beginning
+    uint32_t count;
+
+    //! @brief Pointer to the data of the hardware timer, shared by all timers
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Function that is called after a timer has expired, `NULL` is allowed
+    software_timer_compact_handler_t on_tick;
+
+    //! @brief Optional pointer to user data, `NULL` is allowed
+    void * user_data;
+
+}software_timer_compact_pool_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_compact can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_compact_sc
+{
+    software_timer_compact_t * (*Add) (software_timer_compact_pool_t * pool, uint32_t handle, uint32_t period);
+    software_timer_duration_flag_t (*CalculatePeriod) (const software_timer_timer_info_t * timer_info, double time_in_seconds, uint32_t * period);
+    void (*Init) (software_timer_compact_pool_t * pool, software_timer_compact_t * timers, uint32_t capacity, const software_timer_timer_info_t * timer_info, software_timer_compact_handler_t on_tick);
+    bool (*IsRunning) (const software_timer_compact_t * timer);
+    uint64_t (*NextDeadline) (const software_timer_compact_pool_t * pool);
+    uint32_t (*Poll) (software_timer_compact_pool_t * pool);
+    bool (*Remove) (software_timer_compact_pool_t * pool, software_timer_compact_t * timer);
+    void (*Start) (software_timer_compact_pool_t * pool, software_timer_compact_t * timer);
+    void (*Stop) (software_timer_compact_t * timer);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_compact_pool_s
+extern const struct software_timer_compact_sc software_timer_compact;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Adds a stopped timer to the pool
+//!
+//! @param[in,out] pool The pool of compact timers
+//! @param handle User-defined handle or index
+//! @param period The duration in ticks
+//! @return Returns the timer or `NULL` if the pool is full
+software_timer_compact_t * software_timer_compact_add (software_timer_compact_pool_t * pool, uint32_t handle, uint32_t period);
+
+//! @brief Calculates the period in ticks according to the specified time
+//!
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param time_in_seconds The time after which the timer expires
+//! @param[out] period The period in ticks, at most `UINT32_MAX`
+//! @return Returns the flags with information about the calculated period
+software_timer_duration_flag_t software_timer_compact_calculate_period (const software_timer_timer_info_t * timer_info, double time_in_seconds, uint32_t * period);
+
+//! @brief Initializes an empty pool
+//!
+//! @param[out] pool The pool of compact timers
+//! @param[in] timers Storage of the timers
+//! @param capacity Number of elements of `timers`
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param on_tick Function that is called after a timer has expired, `NULL` is allowed
+void software_timer_compact_init (software_timer_compact_pool_t * pool, software_timer_compact_t * timers, uint32_t capacity, const software_timer_timer_info_t * timer_info, software_timer_compact_handler_t on_tick);
+
+//! @brief Checks if the timer is running
+//!
+//! @param[in] timer The compact timer
+//! @retval true  when the timer is running
+//! @retval false if the timer is stopped
+bool software_timer_compact_is_running (const software_timer_compact_t * timer);
+
+//! @brief Determines the earliest deadline of all timers in the pool
+//!
+//! @param[in] pool The pool of compact timers
+//! @return Returns the earliest deadline, ::SOFTWARE_TIMER_COMPACT_STOPPED if no timer is running
+uint64_t software_timer_compact_next_deadline (const software_timer_compact_pool_t * pool);
+
+//! @brief Checks all timers of the pool with one read of the hardware timer
+//!
+//! @details The handler ::software_timer_compact_pool_s::on_tick is called for each
+//! expired timer. Before that, the timer is restarted with its last deadline as with
+//! ::software_timer_elapsed(), a one-shot timer can be realized by stopping the timer
+//! in the handler. The handler may start and stop timers, but must not add or remove timers.
+//!
+//! @param[in,out] pool The pool of compact timers
+//! @return Returns the number of expired timers
+uint32_t software_timer_compact_poll (software_timer_compact_pool_t * pool);
+
+//! @brief Removes the timer from the pool
+//!
+//! @details The last timer of the pool is moved to the position of the removed timer,
+//! so that the timers stay without gaps. A pointer to the last timer then refers to an
+//! unused element, the moved timer is found at `timer`. Users that keep pointers should
+//! therefore look up timers by ::software_timer_compact_s::handle after a removal.
+//!
+//! @param[in,out] pool The pool of compact timers
+//! @param[in] timer The timer to be removed
+//! @retval true  when the timer was removed
+//! @retval false if the timer is not an element of the pool in use, nothing was changed
+bool software_timer_compact_remove (software_timer_compact_pool_t * pool, software_timer_compact_t * timer);
+
+//! @brief Starts the timer, the deadline is the current time plus the period
+//!
+//! @param[in] pool The pool of compact timers
+//! @param[in,out] timer The compact timer
+void software_timer_compact_start (software_timer_compact_pool_t * pool, software_timer_compact_t * timer);
+
+//! @brief Stops the timer
+//!
+//! @param[in,out] timer The compact timer
+void software_timer_compact_stop (software_timer_compact_t * timer);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_COMPACT_H_ */
@@ -0,0 +1,193 @@
+//! @file
+//! @brief The software_timer_concurrent header file.
+//!
+//! @details The module can be used in C and C++ with GCC or Clang.
+//!
+//! A timer set for host builds in which any thread adds and cancels timers while one or more
+//! poller threads check them. The timers live in slots provided by the user, each slot has an
+//! atomic state word with a phase and a generation. A thread owns a slot by changing its phase
+//! with compare-and-swap, so adding, polling and cancelling need no lock. Since the slots are
+//! never returned to the memory allocator, no hazard pointers or epochs are required, the
+//! generation in the handle prevents a stale handle from cancelling a reused slot.
+//!
+//! After ::software_timer_concurrent_cancel() returns `true` the handler of the timer is not
+//! called anymore, a handler that is running at this time has finished.
+
+
+#ifndef INC_SOFTWARE_TIMER_CONCURRENT_H_
+#define INC_SOFTWARE_TIMER_CONCURRENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+#ifndef SOFTWARE_TIMER_CONCURRENT_INDEX_BITS
+
+//! @brief Number of bits of the slot index in a handle, the remaining bits
+//! are used for the generation. It can be redefined if required.
+#define SOFTWARE_TIMER_CONCURRENT_INDEX_BITS (20)
+
+#endif
+
+//! @brief Mask of the slot index in a handle
+#define SOFTWARE_TIMER_CONCURRENT_INDEX_MASK ((UINT32_C(1) << SOFTWARE_TIMER_CONCURRENT_INDEX_BITS) - 1)
+
+//! @brief Mask of the generation in a handle
+#define SOFTWARE_TIMER_CONCURRENT_GENERATION_MASK (UINT32_MAX >> SOFTWARE_TIMER_CONCURRENT_INDEX_BITS)
+
+//! @brief Handle that never refers to a timer
+#define SOFTWARE_TIMER_CONCURRENT_INVALID_HANDLE (UINT32_MAX)
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief Handle of a timer in a concurrent set, consists of index and generation
+typedef uint32_t software_timer_concurrent_handle_t;
+
+
+//! @brief The phase of a slot, the lowest two bits of ::software_timer_concurrent_slot_s::state
+typedef enum software_timer_concurrent_phase_e
+{
+    //! @brief The slot is free
+    SOFTWARE_TIMER_CONCURRENT_PHASE_FREE = 0,
+
+    //! @brief A thread copies a timer into the slot
+    SOFTWARE_TIMER_CONCURRENT_PHASE_WRITING = 1,
+
+    //! @brief The timer is running and can be polled or cancelled
+    SOFTWARE_TIMER_CONCURRENT_PHASE_ARMED = 2,
+
+    //! @brief A poller checks the timer and calls its handler
+    SOFTWARE_TIMER_CONCURRENT_PHASE_POLLING = 3,
+
+}software_timer_concurrent_phase_t;
+
+
+//! @brief A slot of a concurrent set
+typedef struct software_timer_concurrent_slot_s
+{
+    //! @brief Generation shifted left by two plus ::software_timer_concurrent_phase_t, changed atomically
+    uint32_t state;
+
+    //! @brief The state of the slot when ::software_timer_concurrent_cancel() was called while a
+    //! poller owned it, `0` if not cancelled
+    uint32_t cancelled;
+
+    //! @brief `false` if the slot is freed after the timer has expired once
+    bool periodic;
+
+    //! @brief The timer, only accessed by the owner of the slot
+    software_timer_t timer;
+
+}software_timer_concurrent_slot_t;
+
+
+//! @brief The object data of a concurrent set
+typedef struct software_timer_concurrent_s
+{
+    //! @brief Storage of the slots, provided by the user
+    software_timer_concurrent_slot_t * slots;
+
+    //! @brief Number of elements of ::software_timer_concurrent_s::slots
+    uint32_t capacity;
+
+    //! @brief Slot at which the next search for a free slot starts, a hint only
+    uint32_t next;
+
+}software_timer_concurrent_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_concurrent can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_concurrent_sc
+{
+    software_timer_concurrent_handle_t (*Add) (software_timer_concurrent_t * set, const software_timer_t * timer, bool periodic);
+    bool (*Cancel) (software_timer_concurrent_t * set, software_timer_concurrent_handle_t handle);
+    bool (*Init) (software_timer_concurrent_t * set, software_timer_concurrent_slot_t * slots, uint32_t capacity);
+    bool (*IsArmed) (const software_timer_concurrent_t * set, software_timer_concurrent_handle_t handle);
+    uint32_t (*Poll) (software_timer_concurrent_t * set);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_concurrent_s
+extern const struct software_timer_concurrent_sc software_timer_concurrent;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Adds a copy of a running timer, can be called by any thread
+//!
+//! @param[in,out] set The concurrent set
+//! @param[in] timer The timer, already started, e.g. with ::software_timer_start()
+//! @param periodic `true` if the timer is restarted after it has expired, `false` if it is removed
+//! @return Returns the handle of the timer or ::SOFTWARE_TIMER_CONCURRENT_INVALID_HANDLE if no slot is free
+software_timer_concurrent_handle_t software_timer_concurrent_add (software_timer_concurrent_t * set, const software_timer_t * timer, bool periodic);
+
+//! @brief Removes a timer, can be called by any thread
+//!
+//! @details If a poller is calling the handler of the timer, the function waits until the
+//! handler has finished. It must therefore not be called from the handler of the same timer.
+//!
+//! @param[in,out] set The concurrent set
+//! @param handle The handle of the timer
+//! @retval true  when the timer was removed, its handler is not called anymore
+//! @retval false if the handle is no longer valid, e.g. a one-shot timer has already expired
+bool software_timer_concurrent_cancel (software_timer_concurrent_t * set, software_timer_concurrent_handle_t handle);
+
+//! @brief Initializes an empty set
+//!
+//! @param[out] set The concurrent set
+//! @param[in] slots Storage of the slots
+//! @param capacity Number of elements of `slots`
+//! @retval true  when the set was initialized
+//! @retval false if the capacity exceeds the index bits of a handle
+bool software_timer_concurrent_init (software_timer_concurrent_t * set, software_timer_concurrent_slot_t * slots, uint32_t capacity);
+
+//! @brief Checks whether the handle refers to a timer of the set
+//!
+//! @param[in] set The concurrent set
+//! @param handle The handle of the timer
+//! @return Returns `true` if the timer is running, also while it is polled
+bool software_timer_concurrent_is_armed (const software_timer_concurrent_t * set, software_timer_concurrent_handle_t handle);
+
+//! @brief Checks all timers and calls the handlers of the expired ones
+//!
+//! @details Several threads can poll at the same time, each timer is checked by one of them.
+//! A timer that is currently checked by another poller is skipped.
+//!
+//! @param[in,out] set The concurrent set
+//! @return Returns the number of expired timers
+uint32_t software_timer_concurrent_poll (software_timer_concurrent_t * set);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_CONCURRENT_H_ */
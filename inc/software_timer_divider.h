@@ -0,0 +1,164 @@
+//! @file
+//! @brief The software_timer_divider header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A divider tree derives timers with integer multiples of a base rate, e.g.
+//! 1 ms, 10 ms, 100 ms and 1 s, from one ::software_timer_t. Only the base timer
+//! reads the hardware timer, each divider is a decrementing counter that is only
+//! advanced when its parent has expired. A check therefore costs one comparison
+//! as long as the base timer has not expired.
+
+
+#ifndef INC_SOFTWARE_TIMER_DIVIDER_H_
+#define INC_SOFTWARE_TIMER_DIVIDER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief Forward declaration
+struct software_timer_divider_s;
+
+//! @brief Forward typedef, for information see ::software_timer_divider_s
+typedef struct software_timer_divider_s software_timer_divider_t;
+
+
+//! @brief Function pointer type as a handler that is called after a divider has expired
+//!
+//! @param[in,out] divider The expired divider
+typedef void (*software_timer_divider_handler_t)(software_timer_divider_t * divider);
+
+
+//! @brief The object data of a divider, a timer derived from its parent
+typedef struct software_timer_divider_s
+{
+    //! @brief The parent divider, `NULL` if the parent is the base timer
+    const software_timer_divider_t * parent;
+
+    //! @brief Number of expiries of the parent after which the divider expires
+    uint32_t divider;
+
+    //! @brief Number of expiries of the parent until the divider expires
+    uint32_t remaining;
+
+    //! @brief `true` if the divider has expired at the last check of the tree
+    bool fired;
+
+    //! @brief Function that is called after the divider has expired, `NULL` is allowed
+    software_timer_divider_handler_t on_tick;
+
+    //! @brief Optional pointer to user data, `NULL` is allowed
+    void * user_data;
+
+}software_timer_divider_t;
+
+
+//! @brief The object data of a divider tree
+typedef struct software_timer_divider_tree_s
+{
+    //! @brief The base timer, it must be started by the user
+    software_timer_t * base;
+
+    //! @brief Storage of the dividers, provided by the user
+    //! @details A parent is always stored before its children.
+    software_timer_divider_t * dividers;
+
+    //! @brief Number of elements of ::software_timer_divider_tree_s::dividers
+    uint32_t capacity;
+
+    //! @brief Number of dividers in use
+    uint32_t count;
+
+}software_timer_divider_tree_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_divider can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_divider_sc
+{
+    software_timer_divider_t * (*Add) (software_timer_divider_tree_t * tree, const software_timer_divider_t * parent, uint32_t divider, software_timer_divider_handler_t on_tick);
+    void (*Init) (software_timer_divider_tree_t * tree, software_timer_t * base, software_timer_divider_t * dividers, uint32_t capacity);
+    uint32_t (*Poll) (software_timer_divider_tree_t * tree);
+    void (*Reset) (software_timer_divider_tree_t * tree);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_divider_tree_s
+extern const struct software_timer_divider_sc software_timer_divider;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Adds a divider to the tree
+//!
+//! @details Example of a tree with the base timer set to 1 ms:
+//! @code
+//! software_timer_divider_t * divider_10ms = software_timer_divider.Add(&tree, NULL, 10, on_10ms);
+//! software_timer_divider_t * divider_100ms = software_timer_divider.Add(&tree, divider_10ms, 10, on_100ms);
+//! software_timer_divider.Add(&tree, divider_100ms, 10, on_1s);
+//! @endcode
+//!
+//! @param[in,out] tree The divider tree
+//! @param[in] parent The parent divider, which must already be in the tree, `NULL` for the base timer
+//! @param divider Number of expiries of the parent after which the divider expires
+//! @param on_tick Function that is called after the divider has expired, `NULL` is allowed
+//! @return Returns the divider or `NULL` if the tree is full or `divider` is `0`
+software_timer_divider_t * software_timer_divider_add (software_timer_divider_tree_t * tree, const software_timer_divider_t * parent, uint32_t divider, software_timer_divider_handler_t on_tick);
+
+//! @brief Initializes an empty tree
+//!
+//! @param[out] tree The divider tree
+//! @param[in] base The base timer, see ::software_timer_s::on_tick for its own handler
+//! @param[in] dividers Storage of the dividers
+//! @param capacity Number of elements of `dividers`
+void software_timer_divider_init (software_timer_divider_tree_t * tree, software_timer_t * base, software_timer_divider_t * dividers, uint32_t capacity);
+
+//! @brief Checks the base timer with ::software_timer_elapsed() and advances the dividers
+//!
+//! @details The hardware timer is only read by the base timer. If it has expired, each divider
+//! whose parent has expired is decremented and its handler is called when it reaches zero.
+//! Parents are handled before their children.
+//!
+//! @param[in,out] tree The divider tree
+//! @return Returns the number of expired dividers
+uint32_t software_timer_divider_poll (software_timer_divider_tree_t * tree);
+
+//! @brief Restarts all dividers with their full count, e.g. after the base timer has been restarted
+//!
+//! @param[in,out] tree The divider tree
+void software_timer_divider_reset (software_timer_divider_tree_t * tree);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_DIVIDER_H_ */
@@ -0,0 +1,199 @@
+//! @file
+//! @brief The software_timer_edf header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! An earliest-deadline-first run queue for sporadic jobs with absolute deadlines.
+//! The absolute deadline of a job is the end value of its ::software_timer_t, the
+//! queue is a binary heap ordered by the deadline in ticks, see
+//! ::software_timer_get_deadline_ticks(). Insertion and removal are O(log N).
+
+
+#ifndef INC_SOFTWARE_TIMER_EDF_H_
+#define INC_SOFTWARE_TIMER_EDF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+//! @brief Heap index of a job that is not in a queue
+#define SOFTWARE_TIMER_EDF_NOT_QUEUED (UINT32_MAX)
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief Forward declaration
+struct software_timer_edf_job_s;
+
+//! @brief Forward typedef, for information see ::software_timer_edf_job_s
+typedef struct software_timer_edf_job_s software_timer_edf_job_t;
+
+
+//! @brief Function pointer type of a job and of the deadline-miss handler
+//!
+//! @param[in,out] job The job
+typedef void (*software_timer_edf_function_t)(software_timer_edf_job_t * job);
+
+
+//! @brief The object data of a job
+typedef struct software_timer_edf_job_s
+{
+    //! @brief The end value of the timer is the absolute deadline of the job
+    //! @details It is set with ::software_timer_start() for a relative or
+    //! ::software_timer_start_at() for an absolute deadline.
+    software_timer_t timer;
+
+    //! @brief Function of the job
+    software_timer_edf_function_t function;
+
+    //! @brief Optional pointer to user data, `NULL` is allowed
+    void * user_data;
+
+    //! @brief The deadline in ticks when the job was queued
+    uint64_t deadline;
+
+    //! @brief Position in the heap, ::SOFTWARE_TIMER_EDF_NOT_QUEUED if the job is not queued
+    uint32_t heap_index;
+
+    //! @brief `true` if the last run finished after the deadline
+    bool missed;
+
+}software_timer_edf_job_t;
+
+
+//! @brief The object data of the run queue
+typedef struct software_timer_edf_s
+{
+    //! @brief Storage of the heap, provided by the user
+    software_timer_edf_job_t ** heap;
+
+    //! @brief Number of elements of ::software_timer_edf_s::heap
+    uint32_t capacity;
+
+    //! @brief Number of queued jobs
+    uint32_t count;
+
+    //! @brief Pointer to the data of the hardware timer, shared by all jobs
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Function that is called after a job has finished after its deadline, `NULL` is allowed
+    software_timer_edf_function_t on_miss;
+
+    //! @brief Number of jobs that have been run
+    uint32_t runs;
+
+    //! @brief Number of jobs that have finished after their deadline
+    uint32_t misses;
+
+}software_timer_edf_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_edf can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_edf_sc
+{
+    software_timer_edf_job_t * (*Dispatch) (software_timer_edf_t * queue);
+    void (*Init) (software_timer_edf_t * queue, software_timer_edf_job_t ** heap, uint32_t capacity, const software_timer_timer_info_t * timer_info, software_timer_edf_function_t on_miss);
+    void (*JobInit) (software_timer_edf_job_t * job, const software_timer_timer_info_t * timer_info, software_timer_edf_function_t function);
+    software_timer_edf_job_t * (*Next) (const software_timer_edf_t * queue);
+    software_timer_edf_job_t * (*Pop) (software_timer_edf_t * queue);
+    bool (*Push) (software_timer_edf_t * queue, software_timer_edf_job_t * job);
+    bool (*Remove) (software_timer_edf_t * queue, software_timer_edf_job_t * job);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_edf_s
+extern const struct software_timer_edf_sc software_timer_edf;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Removes the job with the earliest deadline from the queue and runs it
+//!
+//! @details The hardware timer is read once after the run, if this time is past the deadline
+//! the miss is counted and ::software_timer_edf_s::on_miss is called. A job may queue
+//! itself or other jobs again.
+//!
+//! @param[in,out] queue The run queue
+//! @return Returns the job that was run or `NULL` if the queue is empty
+software_timer_edf_job_t * software_timer_edf_dispatch (software_timer_edf_t * queue);
+
+//! @brief Initializes an empty run queue
+//!
+//! @param[out] queue The run queue
+//! @param[in] heap Storage of the heap, one pointer per job
+//! @param capacity Number of elements of `heap`
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param on_miss Function that is called after a deadline miss, `NULL` is allowed
+void software_timer_edf_init (software_timer_edf_t * queue, software_timer_edf_job_t ** heap, uint32_t capacity, const software_timer_timer_info_t * timer_info, software_timer_edf_function_t on_miss);
+
+//! @brief Initializes a job that is not queued and has no deadline
+//!
+//! @param[out] job The job
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param function Function of the job
+void software_timer_edf_job_init (software_timer_edf_job_t * job, const software_timer_timer_info_t * timer_info, software_timer_edf_function_t function);
+
+//! @brief Returns the job with the earliest deadline without removing it
+//!
+//! @param[in] queue The run queue
+//! @return Returns the job or `NULL` if the queue is empty
+software_timer_edf_job_t * software_timer_edf_next (const software_timer_edf_t * queue);
+
+//! @brief Removes the job with the earliest deadline from the queue
+//!
+//! @param[in,out] queue The run queue
+//! @return Returns the job or `NULL` if the queue is empty
+software_timer_edf_job_t * software_timer_edf_pop (software_timer_edf_t * queue);
+
+//! @brief Queues the job with the current end value of its timer as deadline
+//!
+//! @details If the deadline is changed afterwards, the job must be removed and queued again.
+//! A job without deadline, i.e. a stopped timer, is queued last.
+//!
+//! @param[in,out] queue The run queue
+//! @param[in,out] job The job
+//! @retval true  when the job was queued
+//! @retval false if the queue is full or the job is already queued
+bool software_timer_edf_push (software_timer_edf_t * queue, software_timer_edf_job_t * job);
+
+//! @brief Removes the job from the queue
+//!
+//! @param[in,out] queue The run queue
+//! @param[in,out] job The job
+//! @retval true  when the job was removed
+//! @retval false if the job is not queued
+bool software_timer_edf_remove (software_timer_edf_t * queue, software_timer_edf_job_t * job);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_EDF_H_ */
@@ -0,0 +1,159 @@
+//! @file
+//! @brief The software_timer_group header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A group holds up to 64 timers of the same hardware timer. A check returns a
+//! bitmask of the expired members, so that a scheduler can iterate over the set
+//! bits instead of calling ::software_timer_elapsed() for each timer. The earliest
+//! deadline of the group is kept, as long as it is not reached, a check costs a
+//! single comparison.
+
+
+#ifndef INC_SOFTWARE_TIMER_GROUP_H_
+#define INC_SOFTWARE_TIMER_GROUP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+//! @brief Maximum number of members of a group, one bit each in a `uint64_t`
+#define SOFTWARE_TIMER_GROUP_MEMBERS (64)
+
+//! @brief Index that never refers to a member
+#define SOFTWARE_TIMER_GROUP_INVALID_INDEX (UINT8_MAX)
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The object data of a group of software timers
+typedef struct software_timer_group_s
+{
+    //! @brief The members, `NULL` if the index is not used
+    software_timer_t * members[SOFTWARE_TIMER_GROUP_MEMBERS];
+
+    //! @brief Bitmask of the used indexes of ::software_timer_group_s::members
+    uint64_t used;
+
+    //! @brief No member expires before these ticks, see ::software_timer_get_deadline_ticks()
+    //! @details The value is lowered when a member is started and recalculated when the members are checked.
+    uint64_t earliest;
+
+    //! @brief Pointer to the data of the hardware timer, shared by all members
+    const software_timer_timer_info_t * timer_info;
+
+}software_timer_group_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_group can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_group_sc
+{
+    uint8_t (*Add) (software_timer_group_t * group, software_timer_t * timer);
+    void (*Init) (software_timer_group_t * group, const software_timer_timer_info_t * timer_info);
+    uint64_t (*NextDeadline) (const software_timer_group_t * group);
+    uint64_t (*Poll) (software_timer_group_t * group);
+    void (*Remove) (software_timer_group_t * group, uint8_t index);
+    void (*Start) (software_timer_group_t * group, uint8_t index);
+    void (*Update) (software_timer_group_t * group);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_group_s
+extern const struct software_timer_group_sc software_timer_group;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Adds a timer to the group at the lowest free index
+//!
+//! @param[in,out] group The group of software timers
+//! @param[in] timer The timer, it must use ::software_timer_group_s::timer_info
+//! @return Returns the index of the member or ::SOFTWARE_TIMER_GROUP_INVALID_INDEX if the group is full
+uint8_t software_timer_group_add (software_timer_group_t * group, software_timer_t * timer);
+
+//! @brief Initializes an empty group
+//!
+//! @param[out] group The group of software timers
+//! @param[in] timer_info Pointer to the data of the hardware timer
+void software_timer_group_init (software_timer_group_t * group, const software_timer_timer_info_t * timer_info);
+
+//! @brief Returns the ticks before which no member expires
+//!
+//! @param[in] group The group of software timers
+//! @return Returns the ticks, `UINT64_MAX` if no member is running
+uint64_t software_timer_group_next_deadline (const software_timer_group_t * group);
+
+//! @brief Checks all members with one read of the hardware timer
+//!
+//! @details If the earliest deadline has not been reached, only one comparison is made.
+//! Otherwise each expired member is restarted with its last end value as with
+//! ::software_timer_elapsed(), but its handler is not called. Example:
+//! @code
+//! uint64_t expired = software_timer_group.Poll(&group);
+//!
+//! while(0 != expired)
+//! {
+//!     uint8_t index = (uint8_t)__builtin_ctzll(expired);
+//!     expired &= expired - 1;
+//!     // handle the member `index`
+//! }
+//! @endcode
+//!
+//! @param[in,out] group The group of software timers
+//! @return Returns the bitmask of the expired members, bit `n` is the member with index `n`
+uint64_t software_timer_group_poll (software_timer_group_t * group);
+
+//! @brief Removes the member from the group, the timer itself is not changed
+//!
+//! @param[in,out] group The group of software timers
+//! @param index The index of the member
+void software_timer_group_remove (software_timer_group_t * group, uint8_t index);
+
+//! @brief Starts the member, see ::software_timer_start(), and updates the earliest deadline
+//!
+//! @param[in,out] group The group of software timers
+//! @param index The index of the member
+void software_timer_group_start (software_timer_group_t * group, uint8_t index);
+
+//! @brief Recalculates the earliest deadline
+//!
+//! @details Must be called after a member has been started or changed without the group,
+//! e.g. with ::software_timer_start() or ::software_timer_set_slack(). Stopping a member
+//! does not require an update.
+//!
+//! @param[in,out] group The group of software timers
+void software_timer_group_update (software_timer_group_t * group);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_GROUP_H_ */
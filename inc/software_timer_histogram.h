@@ -0,0 +1,153 @@
+//! @file
+//! @brief The software_timer_histogram header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A log-linear histogram of tick deltas with fixed memory, similar to an HDR histogram.
+//! Values below `2^SUB_BITS` are counted exactly, larger values are counted in buckets whose
+//! width grows with the power of two of the value, so the relative error is at most
+//! `2^-(SUB_BITS - 1)`, with the default settings 0.8 % from 1 tick to approx. 1 hour at 1 GHz.
+//! Recording is O(1) without loops. Per-thread histograms can be merged into a shared one
+//! with atomic operations.
+
+
+#ifndef INC_SOFTWARE_TIMER_HISTOGRAM_H_
+#define INC_SOFTWARE_TIMER_HISTOGRAM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+#ifndef SOFTWARE_TIMER_HISTOGRAM_SUB_BITS
+
+//! @brief Number of bits of the exactly counted values, determines the precision.
+//! It can be redefined if required.
+#define SOFTWARE_TIMER_HISTOGRAM_SUB_BITS (8)
+
+#endif
+
+#ifndef SOFTWARE_TIMER_HISTOGRAM_MAX_BITS
+
+//! @brief Number of bits of the largest value, larger values are counted in the last bucket.
+//! It can be redefined if required, the default covers one hour at 1 GHz.
+#define SOFTWARE_TIMER_HISTOGRAM_MAX_BITS (42)
+
+#endif
+
+//! @brief Number of buckets of a histogram
+#define SOFTWARE_TIMER_HISTOGRAM_BUCKETS \
+    ((UINT32_C(1) << SOFTWARE_TIMER_HISTOGRAM_SUB_BITS) + \
+     (SOFTWARE_TIMER_HISTOGRAM_MAX_BITS - SOFTWARE_TIMER_HISTOGRAM_SUB_BITS) * (UINT32_C(1) << (SOFTWARE_TIMER_HISTOGRAM_SUB_BITS - 1)))
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The object data of a histogram
+typedef struct software_timer_histogram_s
+{
+    //! @brief Number of values per bucket
+    uint32_t counts[SOFTWARE_TIMER_HISTOGRAM_BUCKETS];
+
+    //! @brief Number of all values
+    uint64_t count;
+
+    //! @brief Number of values that are greater than or equal to `2^SOFTWARE_TIMER_HISTOGRAM_MAX_BITS`
+    uint64_t saturated;
+
+    //! @brief Smallest value, `UINT64_MAX` if there is no value
+    uint64_t min;
+
+    //! @brief Largest value
+    uint64_t max;
+
+}software_timer_histogram_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_histogram can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_histogram_sc
+{
+    void (*Init) (software_timer_histogram_t * histogram);
+    void (*Merge) (software_timer_histogram_t * destination, const software_timer_histogram_t * source);
+    uint64_t (*Percentile) (const software_timer_histogram_t * histogram, double percentile);
+    void (*Record) (software_timer_histogram_t * histogram, uint64_t ticks);
+    void (*RecordInterval) (software_timer_histogram_t * histogram, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_histogram_s
+extern const struct software_timer_histogram_sc software_timer_histogram;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Initializes an empty histogram, can also be used to reset it
+//!
+//! @param[out] histogram The histogram
+void software_timer_histogram_init (software_timer_histogram_t * histogram);
+
+//! @brief Adds all values of the source to the destination
+//!
+//! @details With GCC or Clang the destination is changed with atomic operations, so several
+//! threads can merge their own histograms into a shared one without a lock. The source must
+//! not be changed at the same time.
+//!
+//! @param[in,out] destination The shared histogram
+//! @param[in] source The histogram, e.g. of one thread
+void software_timer_histogram_merge (software_timer_histogram_t * destination, const software_timer_histogram_t * source);
+
+//! @brief Determines the value below or equal to which the given percentage of values lies
+//!
+//! @details The result is the largest value of the bucket, but not greater than
+//! ::software_timer_histogram_s::max.
+//!
+//! @param[in] histogram The histogram
+//! @param percentile The percentage from 0 to 100, e.g. `99.9`
+//! @return Returns the value in ticks, `0` if the histogram is empty
+uint64_t software_timer_histogram_percentile (const software_timer_histogram_t * histogram, double percentile);
+
+//! @brief Records a value
+//!
+//! @param[in,out] histogram The histogram, it must not be used by another thread at the same time
+//! @param ticks The value, e.g. the difference of two timestamps in ticks
+void software_timer_histogram_record (software_timer_histogram_t * histogram, uint64_t ticks);
+
+//! @brief Records the ticks between two timestamps
+//!
+//! @param[in,out] histogram The histogram, it must not be used by another thread at the same time
+//! @param[in] start The earlier timestamp
+//! @param[in] end The later timestamp
+void software_timer_histogram_record_interval (software_timer_histogram_t * histogram, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_HISTOGRAM_H_ */
@@ -0,0 +1,126 @@
+//! @file
+//! @brief The software_timer_host header file.
+//!
+//! @details The module can be used in C and C++ on Linux.
+//!
+//! A clock backend for host builds without a hardware timer. The `counter` and `overflows` of a
+//! ::software_timer_timer_info_t point to the object, ::software_timer_host_update() sets them to
+//! the time of `CLOCK_MONOTONIC` since ::software_timer_host_init(). The counter is written
+//! before the overflows, so a timer never sees a time later than the real one.
+
+
+#ifndef INC_SOFTWARE_TIMER_HOST_H_
+#define INC_SOFTWARE_TIMER_HOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#if defined(__linux__)
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The object data of a host clock
+typedef struct software_timer_host_s
+{
+    //! @brief The counter, ::software_timer_timer_info_s::counter points to it
+    volatile uint16_t counter;
+
+    //! @brief The overflows, ::software_timer_timer_info_s::overflows points to it
+    volatile uint64_t overflows;
+
+    //! @brief Pointer to the timer data connected to the clock
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief `CLOCK_MONOTONIC` in nanoseconds at tick 0
+    uint64_t epoch_ns;
+
+}software_timer_host_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_host can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_host_sc
+{
+    software_timer_timer_info_flag_t (*Init) (software_timer_host_t * host, software_timer_timer_info_t * timer_info);
+    uint64_t (*MonotonicNs) (void);
+    uint64_t (*NsToTicks) (uint64_t ns, uint64_t ticks_per_second);
+    uint64_t (*Update) (software_timer_host_t * host);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_host_s
+extern const struct software_timer_host_sc software_timer_host;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Initializes the clock at tick 0 and connects it to the timer data
+//!
+//! @details The fields `capture_compare`, `prescaler` and `ticks_per_second` of `timer_info`
+//! must be set before, e.g. `0xFFFF`, `0` and `1000000` for microseconds.
+//!
+//! @param[out] host The clock
+//! @param[in,out] timer_info The timer data
+//! @return Returns the flags of ::software_timer_timer_info_init()
+software_timer_timer_info_flag_t software_timer_host_init (software_timer_host_t * host, software_timer_timer_info_t * timer_info);
+
+//! @brief Reads `CLOCK_MONOTONIC`
+//!
+//! @return Returns the time in nanoseconds
+uint64_t software_timer_host_monotonic_ns (void);
+
+//! @brief Converts nanoseconds into ticks with integer arithmetic, rounded down
+//!
+//! @details The nanoseconds are split into whole seconds and the rest, so the products fit
+//! into 64 bits up to approx. 18 GHz.
+//!
+//! @param ns The nanoseconds, e.g. the difference of two values of ::software_timer_host_monotonic_ns()
+//! @param ticks_per_second The tick frequency, see ::software_timer_timer_info_s::ticks_per_second
+//! @return Returns the ticks
+uint64_t software_timer_host_ns_to_ticks (uint64_t ns, uint64_t ticks_per_second);
+
+//! @brief Sets the clock to the time of `CLOCK_MONOTONIC`
+//!
+//! @details It is called before the timers are checked, e.g. after `epoll_wait()` returns.
+//! The nanoseconds are converted with ::software_timer_host_ns_to_ticks().
+//!
+//! @param[in,out] host The clock
+//! @return Returns the ticks since ::software_timer_host_init()
+uint64_t software_timer_host_update (software_timer_host_t * host);
+
+
+#endif /* defined(__linux__) */
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_HOST_H_ */
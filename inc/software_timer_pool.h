@@ -0,0 +1,245 @@
+//! @file
+//! @brief The software_timer_pool header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! The pool manages a fixed number of ::software_timer_t objects in storage
+//! provided by the user, no `malloc` is used. Free timers are linked in an
+//! intrusive free list. A timer is addressed by a 32-bit handle, consisting of
+//! the index and a generation, so that a handle to a freed timer is detected.
+
+
+#ifndef INC_SOFTWARE_TIMER_POOL_H_
+#define INC_SOFTWARE_TIMER_POOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+#ifndef SOFTWARE_TIMER_POOL_INDEX_BITS
+
+//! @brief Number of bits of a handle used for the index, the remaining bits
+//! are used for the generation. It can be redefined if required.
+#define SOFTWARE_TIMER_POOL_INDEX_BITS (20)
+
+#endif
+
+//! @brief Mask of the index of a handle, also the maximum capacity of a pool
+#define SOFTWARE_TIMER_POOL_INDEX_MASK ((UINT32_C(1) << SOFTWARE_TIMER_POOL_INDEX_BITS) - 1)
+
+//! @brief Mask of the generation of a handle after shifting by ::SOFTWARE_TIMER_POOL_INDEX_BITS
+#define SOFTWARE_TIMER_POOL_GENERATION_MASK (UINT32_MAX >> SOFTWARE_TIMER_POOL_INDEX_BITS)
+
+//! @brief Handle that never refers to a timer
+#define SOFTWARE_TIMER_POOL_INVALID_HANDLE (UINT32_MAX)
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief Handle of a timer in a pool, consists of index and generation
+typedef uint32_t software_timer_handle_t;
+
+
+//! @brief The object data of a pool of software timers
+typedef struct software_timer_pool_s
+{
+    //! @brief Storage of the timers, provided by the user
+    //! @details While a timer is free, its ::software_timer_s::duration_overflows
+    //! holds the index of the next free timer.
+    software_timer_t * timers;
+
+    //! @brief Generation of each timer, provided by the user, odd if the timer is allocated
+    uint16_t * generations;
+
+    //! @brief Number of elements of ::software_timer_pool_s::timers and ::software_timer_pool_s::generations
+    uint32_t capacity;
+
+    //! @brief Number of allocated timers
+    uint32_t count;
+
+    //! @brief Index of the first free timer, ::SOFTWARE_TIMER_POOL_INDEX_MASK if there is none
+    uint32_t free_head;
+
+    //! @brief Pointer to the data of the hardware timer, used for all allocated timers
+    const software_timer_timer_info_t * timer_info;
+
+}software_timer_pool_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_pool can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_pool_sc
+{
+    software_timer_handle_t (*Alloc) (software_timer_pool_t * pool);
+    bool (*Free) (software_timer_pool_t * pool, software_timer_handle_t handle);
+    software_timer_t * (*Get) (const software_timer_pool_t * pool, software_timer_handle_t handle);
+    bool (*Init) (software_timer_pool_t * pool, software_timer_t * timers, uint16_t * generations, uint32_t capacity, const software_timer_timer_info_t * timer_info);
+    bool (*IsAllocated) (const software_timer_pool_t * pool, uint32_t index);
+    bool (*IsValid) (const software_timer_pool_t * pool, software_timer_handle_t handle);
+    uint64_t (*NextDeadline) (const software_timer_pool_t * pool);
+    uint32_t (*Pause) (software_timer_pool_t * pool);
+    uint32_t (*Poll) (software_timer_pool_t * pool);
+    uint32_t (*Rescale) (software_timer_pool_t * pool, const software_timer_timer_info_t * new_timer_info);
+    uint32_t (*Resume) (software_timer_pool_t * pool);
+    uint64_t (*Resync) (software_timer_pool_t * pool, software_timer_resync_policy_t policy);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_pool_s
+extern const struct software_timer_pool_sc software_timer_pool;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Allocates a stopped timer, see ::software_timer_init_halt()
+//!
+//! @param[in,out] pool The pool of software timers
+//! @return Returns the handle of the timer or ::SOFTWARE_TIMER_POOL_INVALID_HANDLE if the pool is full
+software_timer_handle_t software_timer_pool_alloc (software_timer_pool_t * pool);
+
+//! @brief Stops and frees the timer, afterwards the handle is no longer valid
+//!
+//! @param[in,out] pool The pool of software timers
+//! @param handle The handle of the timer
+//! @retval true  when the timer was freed
+//! @retval false if the handle is not valid
+bool software_timer_pool_free (software_timer_pool_t * pool, software_timer_handle_t handle);
+
+//! @brief Gets the timer of a handle
+//!
+//! @param[in] pool The pool of software timers
+//! @param handle The handle of the timer
+//! @return Returns the timer or `NULL` if the handle is not valid, e.g. the timer has been freed
+software_timer_t * software_timer_pool_get (const software_timer_pool_t * pool, software_timer_handle_t handle);
+
+//! @brief Initializes an empty pool
+//!
+//! @details Example of the storage:
+//! @code
+//! static software_timer_t timers[100];
+//! static uint16_t generations[100];
+//! @endcode
+//!
+//! @param[out] pool The pool of software timers
+//! @param[in] timers Storage of the timers
+//! @param[in] generations Storage of the generations, the values are kept if the pool is initialized again
+//! @param capacity Number of elements of `timers` and `generations`
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @retval true  when the pool was initialized
+//! @retval false if the capacity is greater than or equal to ::SOFTWARE_TIMER_POOL_INDEX_MASK
+bool software_timer_pool_init (software_timer_pool_t * pool, software_timer_t * timers, uint16_t * generations, uint32_t capacity, const software_timer_timer_info_t * timer_info);
+
+//! @brief Checks if the timer at the index is allocated, can be used to iterate over all timers
+//!
+//! @param[in] pool The pool of software timers
+//! @param index The index of the timer, smaller than ::software_timer_pool_s::capacity
+//! @retval true  when the timer is allocated
+//! @retval false if the timer is free
+bool software_timer_pool_is_allocated (const software_timer_pool_t * pool, uint32_t index);
+
+//! @brief Checks if the handle refers to an allocated timer
+//!
+//! @param[in] pool The pool of software timers
+//! @param handle The handle of the timer
+//! @retval true  when the handle is valid
+//! @retval false if the handle is not valid
+bool software_timer_pool_is_valid (const software_timer_pool_t * pool, software_timer_handle_t handle);
+
+//! @brief Determines the earliest deadline of all timers including their slack
+//!
+//! @details A scheduler can sleep until this value. The following ::software_timer_pool_poll()
+//! also expires the timers whose tolerance window has started, see ::software_timer_set_slack().
+//!
+//! @param[in] pool The pool of software timers
+//! @return Returns the ticks, see ::software_timer_get_deadline_ticks(), `UINT64_MAX` if no timer is running
+uint64_t software_timer_pool_next_deadline (const software_timer_pool_t * pool);
+
+//! @brief Pauses all running timers with one read of the hardware timer
+//!
+//! @details All timers keep their remaining time relative to the same instant, see
+//! ::software_timer_pause(). Stopped and already paused timers are not changed.
+//!
+//! @param[in,out] pool The pool of software timers
+//! @return Returns the number of paused timers
+uint32_t software_timer_pool_pause (software_timer_pool_t * pool);
+
+//! @brief Checks all allocated timers with one read of the hardware timer
+//!
+//! @details A timer expires when its end value without the slack has passed, see
+//! ::software_timer_get_end_ticks(). So all timers within their tolerance window are handled
+//! at the wakeup of ::software_timer_pool_next_deadline(). Each expired timer is handled by
+//! ::software_timer_expire(), its handler is called and it is restarted with its last end value.
+//!
+//! @param[in,out] pool The pool of software timers
+//! @return Returns the number of expired timers
+uint32_t software_timer_pool_poll (software_timer_pool_t * pool);
+
+//! @brief Changes the hardware timer of all timers, e.g. for a change of the clock or the prescaler
+//!
+//! @details All running timers are paused with one read of ::software_timer_pool_s::timer_info, then the
+//! durations and remaining times are converted to the new tick frequency with integer
+//! arithmetic, see ::software_timer_rescale(). The timers stay paused, so that the hardware
+//! timer can be reconfigured. Afterwards ::software_timer_pool_resume() continues all timers
+//! with their remaining time. A timer whose time does not fit into the new tick frequency
+//! is stopped and keeps its hardware timer. Example:
+//! @code
+//! software_timer_pool.Rescale(&pool, &timer_info_slow);
+//! // reconfigure the prescaler of the hardware timer
+//! software_timer_pool.Resume(&pool);
+//! @endcode
+//!
+//! @param[in,out] pool The pool of software timers
+//! @param[in] new_timer_info Pointer to the data of the hardware timer after the change
+//! @return Returns the number of paused timers
+uint32_t software_timer_pool_rescale (software_timer_pool_t * pool, const software_timer_timer_info_t * new_timer_info);
+
+//! @brief Resumes all paused timers with one read of the hardware timer
+//!
+//! @details See ::software_timer_resume(), the relative order of the deadlines is preserved.
+//!
+//! @param[in,out] pool The pool of software timers
+//! @return Returns the number of resumed timers
+uint32_t software_timer_pool_resume (software_timer_pool_t * pool);
+
+//! @brief Resynchronises all running timers with one read of the hardware timer
+//!
+//! @details Should be called after a large jump of the overflows, e.g. after a deep sleep
+//! or a debugger halt, before the next ::software_timer_pool_poll(), see ::software_timer_resync().
+//!
+//! @param[in,out] pool The pool of software timers
+//! @param policy Handling of the missed expiries
+//! @return Returns the total number of missed expiries of all timers
+uint64_t software_timer_pool_resync (software_timer_pool_t * pool, software_timer_resync_policy_t policy);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_POOL_H_ */
@@ -0,0 +1,160 @@
+//! @file
+//! @brief The software_timer_recorder header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A recorder stands between the hardware timer and the library. The library uses a
+//! timer data whose `counter` and `overflows` point to the recorder. Each call of
+//! ::software_timer_recorder_sample() reads the hardware timer, appends the difference to
+//! the previous sample as a zigzag varint to a binary stream and provides the values
+//! to the library. A recorder in replay mode reads the same stream instead of the
+//! hardware, so a recorded timing sequence can be reproduced offline as often as required.
+
+
+#ifndef INC_SOFTWARE_TIMER_RECORDER_H_
+#define INC_SOFTWARE_TIMER_RECORDER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include <stddef.h>
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The object data of a recorder
+typedef struct software_timer_recorder_s
+{
+    //! @brief The sampled counter, ::software_timer_timer_info_s::counter points to it
+    volatile uint16_t counter;
+
+    //! @brief The sampled overflows, ::software_timer_timer_info_s::overflows points to it
+    volatile uint64_t overflows;
+
+    //! @brief Pointer to the timer data used by the library
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Pointer to the data of the hardware timer, `NULL` in replay mode
+    const software_timer_timer_info_t * source;
+
+    //! @brief The stream, provided by the user
+    uint8_t * buffer;
+
+    //! @brief Number of bytes of ::software_timer_recorder_s::buffer
+    size_t capacity;
+
+    //! @brief Number of bytes of the stream
+    size_t size;
+
+    //! @brief Read position in replay mode
+    size_t position;
+
+    //! @brief The ticks of the previous sample
+    uint64_t ticks;
+
+    //! @brief Number of samples written or read
+    uint64_t samples;
+
+    //! @brief Set in record mode when a sample did not fit into the stream
+    bool full;
+
+}software_timer_recorder_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_recorder can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_recorder_sc
+{
+    software_timer_timer_info_flag_t (*InitRecord) (software_timer_recorder_t * recorder, software_timer_timer_info_t * timer_info, const software_timer_timer_info_t * source, uint8_t * buffer, size_t capacity);
+    software_timer_timer_info_flag_t (*InitReplay) (software_timer_recorder_t * recorder, software_timer_timer_info_t * timer_info, const uint8_t * buffer, size_t size);
+    void (*Rewind) (software_timer_recorder_t * recorder);
+    bool (*Sample) (software_timer_recorder_t * recorder);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_recorder_s
+extern const struct software_timer_recorder_sc software_timer_recorder;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Initializes a recorder that writes the samples of the hardware timer to a stream
+//!
+//! @details The configuration of `source` is copied to `timer_info`, its
+//! ::software_timer_timer_info_s::counter and ::software_timer_timer_info_s::overflows are
+//! set to the recorder, then ::software_timer_timer_info_init() is called. All timers that
+//! are to be recorded must use `timer_info`.
+//!
+//! @param[out] recorder The recorder
+//! @param[out] timer_info The timer data used by the library
+//! @param[in] source Pointer to the data of the hardware timer
+//! @param[out] buffer Storage of the stream
+//! @param capacity Number of bytes of `buffer`
+//! @return Returns the flags of ::software_timer_timer_info_init()
+software_timer_timer_info_flag_t software_timer_recorder_init_record (software_timer_recorder_t * recorder, software_timer_timer_info_t * timer_info, const software_timer_timer_info_t * source, uint8_t * buffer, size_t capacity);
+
+//! @brief Initializes a recorder that replays a recorded stream
+//!
+//! @details ::software_timer_timer_info_s::counter and ::software_timer_timer_info_s::overflows
+//! are set to the recorder, then ::software_timer_timer_info_init() is called. The fields
+//! `capture_compare`, `prescaler` and `ticks_per_second` must be set before to the values
+//! of the recording.
+//!
+//! @param[out] recorder The recorder
+//! @param[in,out] timer_info The timer data used by the library
+//! @param[in] buffer The recorded stream, it is not changed
+//! @param size Number of bytes of the stream, see ::software_timer_recorder_s::size
+//! @return Returns the flags of ::software_timer_timer_info_init()
+software_timer_timer_info_flag_t software_timer_recorder_init_replay (software_timer_recorder_t * recorder, software_timer_timer_info_t * timer_info, const uint8_t * buffer, size_t size);
+
+//! @brief Starts the replay again from the first sample, the time is set to 0
+//!
+//! @details In record mode the stream is discarded.
+//!
+//! @param[in,out] recorder The recorder
+void software_timer_recorder_rewind (software_timer_recorder_t * recorder);
+
+//! @brief Samples the timer and provides the value to the library
+//!
+//! @details In record mode the hardware timer is read and the sample is appended to the
+//! stream. In replay mode the next sample is read from the stream. It is called wherever
+//! the application would otherwise let the library read the hardware timer, e.g. before
+//! ::software_timer_elapsed().
+//!
+//! @param[in,out] recorder The recorder
+//! @retval true  when the sample was written or read
+//! @retval false if the stream is full, the value is provided nevertheless but no further
+//!               sample is recorded, or the end of the stream was reached, the value is not changed
+bool software_timer_recorder_sample (software_timer_recorder_t * recorder);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_RECORDER_H_ */
@@ -0,0 +1,181 @@
+//! @file
+//! @brief The software_timer_scheduler header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! The scheduler runs a static table of periodic tasks in rate-monotonic order,
+//! i.e. a task with a shorter period has a higher priority. Each run is measured
+//! with the hardware timer, the worst-case execution time is kept and a run that
+//! finishes after the deadline of the task is reported as an overrun.
+
+
+#ifndef INC_SOFTWARE_TIMER_SCHEDULER_H_
+#define INC_SOFTWARE_TIMER_SCHEDULER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief Forward declaration
+struct software_timer_task_s;
+
+//! @brief Forward typedef, for information see ::software_timer_task_s
+typedef struct software_timer_task_s software_timer_task_t;
+
+
+//! @brief Function pointer type of a task and of the overrun handler
+//!
+//! @param[in,out] task The task
+typedef void (*software_timer_task_function_t)(software_timer_task_t * task);
+
+
+//! @brief The object data of a periodic task
+typedef struct software_timer_task_s
+{
+    //! @brief The timer with the period of the task
+    software_timer_t timer;
+
+    //! @brief Function of the task
+    software_timer_task_function_t function;
+
+    //! @brief Optional pointer to user data, `NULL` is allowed
+    void * user_data;
+
+    //! @brief Priority of tasks with the same period, a smaller value is a higher priority
+    uint8_t priority;
+
+    //! @brief Relative deadline in ticks after the release of the task
+    uint64_t deadline;
+
+    //! @brief Execution time in ticks of the last run
+    uint64_t execution_ticks;
+
+    //! @brief Worst-case execution time in ticks of all runs
+    uint64_t wcet_ticks;
+
+    //! @brief Number of runs
+    uint32_t runs;
+
+    //! @brief Number of runs which finished after the deadline
+    uint32_t overruns;
+
+    //! @brief `true` if the last run finished after the deadline
+    bool overrun;
+
+}software_timer_task_t;
+
+
+//! @brief The object data of the scheduler
+typedef struct software_timer_scheduler_s
+{
+    //! @brief The task table, provided by the user and sorted by ::software_timer_scheduler_init()
+    software_timer_task_t * tasks;
+
+    //! @brief Number of elements of ::software_timer_scheduler_s::tasks
+    uint32_t count;
+
+    //! @brief Pointer to the data of the hardware timer, shared by all tasks
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Function that is called after a run which finished after the deadline, `NULL` is allowed
+    software_timer_task_function_t on_overrun;
+
+}software_timer_scheduler_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_scheduler can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_scheduler_sc
+{
+    software_timer_task_t * (*Dispatch) (software_timer_scheduler_t * scheduler);
+    void (*Init) (software_timer_scheduler_t * scheduler, software_timer_task_t * tasks, uint32_t count, const software_timer_timer_info_t * timer_info, software_timer_task_function_t on_overrun);
+    void (*ResetStatistics) (software_timer_scheduler_t * scheduler);
+    void (*Start) (software_timer_scheduler_t * scheduler);
+    software_timer_duration_flag_t (*TaskInit) (software_timer_task_t * task, const software_timer_timer_info_t * timer_info, double period_in_seconds, double deadline_in_seconds, uint8_t priority, software_timer_task_function_t function);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_scheduler_s
+extern const struct software_timer_scheduler_sc software_timer_scheduler;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Runs the released task with the highest priority
+//!
+//! @details The tasks are checked in rate-monotonic order with ::software_timer_elapsed(),
+//! the first released task is run and then the function returns. Further released tasks
+//! are run by the next calls. The execution time is measured from the start to the end of
+//! the run, the response time from the release to the end of the run. If the response time
+//! exceeds ::software_timer_task_s::deadline, the run is an overrun.
+//!
+//! @param[in,out] scheduler The scheduler
+//! @return Returns the task that was run or `NULL` if no task was released
+software_timer_task_t * software_timer_scheduler_dispatch (software_timer_scheduler_t * scheduler);
+
+//! @brief Initializes the scheduler and sorts the task table in rate-monotonic order
+//!
+//! @details The tasks are sorted by period and then by ::software_timer_task_s::priority, so
+//! pointers into the table must be taken after this call.
+//!
+//! @param[out] scheduler The scheduler
+//! @param[in,out] tasks The task table, each task initialized by ::software_timer_scheduler_task_init()
+//! @param count Number of elements of `tasks`
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param on_overrun Function that is called after an overrun, `NULL` is allowed
+void software_timer_scheduler_init (software_timer_scheduler_t * scheduler, software_timer_task_t * tasks, uint32_t count, const software_timer_timer_info_t * timer_info, software_timer_task_function_t on_overrun);
+
+//! @brief Resets the execution times and counters of all tasks
+//!
+//! @param[in,out] scheduler The scheduler
+void software_timer_scheduler_reset_statistics (software_timer_scheduler_t * scheduler);
+
+//! @brief Starts all tasks with one read of the hardware timer, so that their releases are aligned
+//!
+//! @param[in,out] scheduler The scheduler
+void software_timer_scheduler_start (software_timer_scheduler_t * scheduler);
+
+//! @brief Initializes a task
+//!
+//! @param[out] task The task
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param period_in_seconds The period of the task
+//! @param deadline_in_seconds The relative deadline, `0` if the deadline is the period
+//! @param priority Priority of tasks with the same period, a smaller value is a higher priority
+//! @param function Function of the task
+//! @return Returns the flags of the calculated period and deadline, see ::software_timer_calculate_duration()
+software_timer_duration_flag_t software_timer_scheduler_task_init (software_timer_task_t * task, const software_timer_timer_info_t * timer_info, double period_in_seconds, double deadline_in_seconds, uint8_t priority, software_timer_task_function_t function);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_SCHEDULER_H_ */
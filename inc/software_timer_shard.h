@@ -0,0 +1,204 @@
+//! @file
+//! @brief The software_timer_shard header file.
+//!
+//! @details The module can be used in C and C++ with GCC or Clang.
+//!
+//! A shard is the timer container of one CPU core or thread. It consists of a pool, see
+//! software_timer_pool.h, whose timers use a core-local snapshot of the shared clock, and a
+//! mailbox. Only the owner thread polls the shard and starts and stops its timers, so the
+//! poll path uses no shared atomics. Other threads send timers to the shard through the
+//! mailbox, a bounded lock-free queue with many producers and one consumer. This is also how
+//! a timer migrates from one shard to another.
+
+
+#ifndef INC_SOFTWARE_TIMER_SHARD_H_
+#define INC_SOFTWARE_TIMER_SHARD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+#include "software_timer_pool.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+typedef struct software_timer_shard_s software_timer_shard_t;
+
+
+//! @brief Function pointer type as a handler that is called after a timer was received
+typedef void (*software_timer_shard_handler_t)(software_timer_shard_t * shard, software_timer_handle_t handle);
+
+
+//! @brief An element of the mailbox
+typedef struct software_timer_shard_message_s
+{
+    //! @brief Sequence number of the lock-free queue
+    uint32_t sequence;
+
+    //! @brief Copy of the sent timer
+    software_timer_t timer;
+
+}software_timer_shard_message_t;
+
+
+//! @brief The object data of a shard
+struct software_timer_shard_s
+{
+    //! @brief The core-local counter, updated by ::software_timer_shard_poll()
+    volatile uint16_t counter;
+
+    //! @brief The core-local overflows, updated by ::software_timer_shard_poll()
+    volatile uint64_t overflows;
+
+    //! @brief The timer data of the shard, its `counter` and `overflows` point to the snapshot
+    software_timer_timer_info_t timer_info;
+
+    //! @brief Pointer to the data of the shared clock
+    const software_timer_timer_info_t * source;
+
+    //! @brief The timers of the shard
+    software_timer_pool_t pool;
+
+    //! @brief Storage of the mailbox, provided by the user
+    software_timer_shard_message_t * messages;
+
+    //! @brief Number of elements of ::software_timer_shard_s::messages minus one, a power of two minus one
+    uint32_t mask;
+
+    //! @brief Read position of the mailbox, only used by the owner thread
+    uint32_t head;
+
+    //! @brief Write position of the mailbox, shared by the senders
+    uint32_t tail;
+
+    //! @brief Function that is called after a timer was received, `NULL` is allowed
+    software_timer_shard_handler_t on_receive;
+
+    //! @brief Optional pointer to user data, `NULL` is allowed
+    void * user_data;
+
+};
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_shard can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_shard_sc
+{
+    software_timer_shard_t * (*Current) (software_timer_shard_t * shards, uint32_t count);
+    bool (*Init) (software_timer_shard_t * shard, const software_timer_timer_info_t * source, software_timer_t * timers, uint16_t * generations, uint32_t capacity, software_timer_shard_message_t * messages, uint32_t message_capacity);
+    bool (*Migrate) (software_timer_shard_t * shard, software_timer_handle_t handle, software_timer_shard_t * destination);
+    uint32_t (*Poll) (software_timer_shard_t * shard);
+    uint32_t (*Receive) (software_timer_shard_t * shard);
+    bool (*Send) (software_timer_shard_t * destination, const software_timer_t * timer);
+    void (*Snapshot) (software_timer_shard_t * shard);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_shard_s
+extern const struct software_timer_shard_sc software_timer_shard;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Returns the shard of the CPU core of the calling thread
+//!
+//! @details On Linux `sched_getcpu()` selects the shard, the core number is reduced modulo
+//! `count`. On other systems the first shard is returned.
+//!
+//! @param[in] shards The shards, one per core
+//! @param count Number of shards
+//! @return Returns the shard
+software_timer_shard_t * software_timer_shard_current (software_timer_shard_t * shards, uint32_t count);
+
+//! @brief Initializes a shard
+//!
+//! @details The configuration of `source` is copied to the timer data of the shard.
+//!
+//! @param[out] shard The shard
+//! @param[in] source Pointer to the data of the shared clock
+//! @param[in] timers Storage of the timers, see ::software_timer_pool_init()
+//! @param[in] generations Storage of the generations, see ::software_timer_pool_init()
+//! @param capacity Number of elements of `timers` and `generations`
+//! @param[in] messages Storage of the mailbox
+//! @param message_capacity Number of elements of `messages`, a power of two
+//! @retval true  when the shard was initialized
+//! @retval false if a capacity is not supported
+bool software_timer_shard_init (software_timer_shard_t * shard, const software_timer_timer_info_t * source, software_timer_t * timers, uint16_t * generations, uint32_t capacity, software_timer_shard_message_t * messages, uint32_t message_capacity);
+
+//! @brief Moves a timer to another shard
+//!
+//! @details It is called by the owner thread of `shard`. The timer keeps its state, e.g. its
+//! deadline and handler, and is freed in `shard`. The destination takes it over at its
+//! next ::software_timer_shard_poll() with a new handle, see ::software_timer_shard_s::on_receive.
+//!
+//! @param[in,out] shard The shard of the timer
+//! @param handle The handle of the timer
+//! @param[in,out] destination The new shard
+//! @retval true  when the timer was sent
+//! @retval false if the handle is invalid or the mailbox of the destination is full, nothing was changed
+bool software_timer_shard_migrate (software_timer_shard_t * shard, software_timer_handle_t handle, software_timer_shard_t * destination);
+
+//! @brief Takes a snapshot of the clock, receives the sent timers and polls all timers
+//!
+//! @details It is called periodically by the owner thread only.
+//!
+//! @param[in,out] shard The shard
+//! @return Returns the number of expired timers
+uint32_t software_timer_shard_poll (software_timer_shard_t * shard);
+
+//! @brief Takes over the sent timers
+//!
+//! @details It is called by the owner thread only. A timer that does not fit into the pool
+//! remains in the mailbox until a timer is freed.
+//!
+//! @param[in,out] shard The shard
+//! @return Returns the number of received timers
+uint32_t software_timer_shard_receive (software_timer_shard_t * shard);
+
+//! @brief Sends a copy of a timer to a shard, e.g. to start a timer on another core
+//!
+//! @details It can be called by any thread at the same time without a lock.
+//!
+//! @param[in,out] destination The shard
+//! @param[in] timer The timer, it must use the same shared clock
+//! @retval true  when the timer was sent
+//! @retval false if the mailbox is full
+bool software_timer_shard_send (software_timer_shard_t * destination, const software_timer_t * timer);
+
+//! @brief Copies the time of the shared clock to the core-local snapshot
+//!
+//! @details It is called by the owner thread only, before starting timers of the shard.
+//!
+//! @param[in,out] shard The shard
+void software_timer_shard_snapshot (software_timer_shard_t * shard);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_SHARD_H_ */
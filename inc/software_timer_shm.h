@@ -0,0 +1,210 @@
+//! @file
+//! @brief The software_timer_shm header file.
+//!
+//! @details The module can be used in C and C++ on Linux.
+//!
+//! A clock source in shared memory for several processes. One producer process creates a
+//! POSIX shared memory object and publishes the time in it, e.g. from `CLOCK_MONOTONIC` with
+//! ::software_timer_shm_update(). Any number of consumer processes attach their
+//! ::software_timer_timer_info_t to it, so ::software_timer_elapsed() works without IPC or
+//! system calls.
+//!
+//! The `counter` and `overflows` of the timer data point to a process-local copy of the
+//! published time in ::software_timer_shm_s, not into the shared memory. The producer writes
+//! under a sequence lock and a consumer copies a consistent snapshot with
+//! ::software_timer_shm_snapshot() before it starts or polls its timers, as
+//! ::software_timer_shard_snapshot() does for a shard. So the timers never combine a counter
+//! and overflows of different updates, also on weakly ordered processors such as ARM.
+//! The producer updates its own copy when it publishes.
+
+#ifndef INC_SOFTWARE_TIMER_SHM_H_
+#define INC_SOFTWARE_TIMER_SHM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#if defined(__linux__)
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+//! @brief Identifies the shared memory, the characters "STSHMCK1"
+#define SOFTWARE_TIMER_SHM_MAGIC (UINT64_C(0x314B434D48535453))
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The content of the shared memory
+typedef struct software_timer_shm_region_s
+{
+    //! @brief ::SOFTWARE_TIMER_SHM_MAGIC, written after the configuration
+    uint64_t magic;
+
+    //! @brief The sequence lock, odd while the producer writes
+    uint32_t sequence;
+
+    //! @brief The published counter, read with the sequence lock
+    volatile uint16_t counter;
+
+    //! @brief The configuration of the clock, see ::software_timer_timer_info_s::capture_compare
+    uint16_t capture_compare;
+
+    //! @brief The published overflows, read with the sequence lock
+    volatile uint64_t overflows;
+
+    //! @brief The configuration of the clock, see ::software_timer_timer_info_s::ticks_per_second
+    uint64_t ticks_per_second;
+
+    //! @brief The configuration of the clock, see ::software_timer_timer_info_s::prescaler
+    uint16_t prescaler;
+
+}software_timer_shm_region_t;
+
+
+//! @brief The object data of a producer or consumer
+typedef struct software_timer_shm_s
+{
+    //! @brief The process-local counter, updated by ::software_timer_shm_snapshot()
+    volatile uint16_t counter;
+
+    //! @brief The process-local overflows, updated by ::software_timer_shm_snapshot()
+    volatile uint64_t overflows;
+
+    //! @brief The mapped shared memory
+    software_timer_shm_region_t * region;
+
+    //! @brief Pointer to the timer data, its `counter` and `overflows` point to the local copy
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief The name of the shared memory object of a producer, `NULL` for a consumer
+    const char * name;
+
+    //! @brief `CLOCK_MONOTONIC` in nanoseconds at tick 0, see ::software_timer_shm_update()
+    uint64_t epoch_ns;
+
+}software_timer_shm_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_shm can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_shm_sc
+{
+    bool (*Attach) (software_timer_shm_t * shm, const char * name, software_timer_timer_info_t * timer_info);
+    void (*Close) (software_timer_shm_t * shm);
+    bool (*Create) (software_timer_shm_t * shm, const char * name, software_timer_timer_info_t * timer_info);
+    void (*Publish) (software_timer_shm_t * shm, uint64_t ticks);
+    void (*Read) (const software_timer_shm_t * shm, software_timer_timestamp_t * timestamp);
+    void (*Snapshot) (software_timer_shm_t * shm);
+    uint64_t (*Update) (software_timer_shm_t * shm);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_shm_s
+extern const struct software_timer_shm_sc software_timer_shm;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Connects a consumer to the shared memory of a producer
+//!
+//! @details The configuration of the producer is copied to `timer_info`, its
+//! ::software_timer_timer_info_s::counter and ::software_timer_timer_info_s::overflows are set
+//! to the local copy in `shm`, then ::software_timer_timer_info_init() is called. A first
+//! snapshot is taken, `shm` must remain valid as long as `timer_info` is used.
+//!
+//! @param[out] shm The consumer
+//! @param[in] name The name of the shared memory object, e.g. "/software_timer"
+//! @param[out] timer_info The timer data of the consumer
+//! @retval true  when the consumer is connected
+//! @retval false if a system call failed or the producer has not finished the creation, `errno` is set
+bool software_timer_shm_attach (software_timer_shm_t * shm, const char * name, software_timer_timer_info_t * timer_info);
+
+//! @brief Unmaps the shared memory, a producer also removes its name
+//!
+//! @details Consumers that are still attached keep their mapping, the published time
+//! does not change anymore.
+//!
+//! @param[in,out] shm The producer or consumer
+void software_timer_shm_close (software_timer_shm_t * shm);
+
+//! @brief Creates the shared memory of a producer at tick 0
+//!
+//! @details The fields `capture_compare`, `prescaler` and `ticks_per_second` of `timer_info`
+//! must be set before, they are published for the consumers. `counter` and `overflows`
+//! are set to the local copy in `shm`, then ::software_timer_timer_info_init() is called.
+//!
+//! @param[out] shm The producer
+//! @param[in] name The name of the shared memory object, the string must remain valid
+//! @param[in,out] timer_info The timer data of the producer
+//! @retval true  when the shared memory was created
+//! @retval false if a system call failed, `errno` is set
+bool software_timer_shm_create (software_timer_shm_t * shm, const char * name, software_timer_timer_info_t * timer_info);
+
+//! @brief Publishes a new time
+//!
+//! @details The local copy of the producer is updated as well.
+//!
+//! @param[in,out] shm The producer
+//! @param ticks The time in ticks, see ::software_timer_set_ticks()
+void software_timer_shm_publish (software_timer_shm_t * shm, uint64_t ticks);
+
+//! @brief Reads a consistent snapshot of the published time
+//!
+//! @details The read is repeated while the producer writes, so `counter` and `overflows`
+//! always belong together, also on 32-bit systems.
+//!
+//! @param[in] shm The producer or consumer
+//! @param[out] timestamp The time, ::software_timer_timestamp_s::timer_info is set as well
+void software_timer_shm_read (const software_timer_shm_t * shm, software_timer_timestamp_t * timestamp);
+
+//! @brief Copies a consistent snapshot of the published time to the local copy
+//!
+//! @details A consumer calls it before starting or polling its timers, the timers see the
+//! published time of the last snapshot, see ::software_timer_shm_read().
+//!
+//! @param[in,out] shm The consumer
+void software_timer_shm_snapshot (software_timer_shm_t * shm);
+
+//! @brief Publishes the time of `CLOCK_MONOTONIC` since ::software_timer_shm_create()
+//!
+//! @details The producer calls it periodically, the resolution of the consumers is the period
+//! of the calls. The nanoseconds are converted with ::software_timer_host_ns_to_ticks().
+//!
+//! @param[in,out] shm The producer
+//! @return Returns the published ticks
+uint64_t software_timer_shm_update (software_timer_shm_t * shm);
+
+
+#endif /* defined(__linux__) */
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_SHM_H_ */
@@ -0,0 +1,269 @@
+//! @file
+//! @brief The software_timer_stopwatch header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A stopwatch measures the time of a code section with two raw timestamps of the
+//! hardware timer. The difference is calculated with integer arithmetic and the
+//! number, minimum, maximum and sum of the measured ticks are accumulated per named
+//! site. No conversion into seconds takes place until the values are reported,
+//! so the measurement can stay enabled in production code.
+//!
+//! The cost of reading the timestamps themselves can be measured at startup with
+//! ::software_timer_stopwatch_calibrate(), it is then subtracted from each measurement.
+//!
+//! In C++ the class `ScopedProfile` measures the lifetime of a scope.
+
+
+#ifndef INC_SOFTWARE_TIMER_STOPWATCH_H_
+#define INC_SOFTWARE_TIMER_STOPWATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The statistics of a measured code section
+typedef struct software_timer_stopwatch_site_s
+{
+    //! @brief Name of the site, the string is not copied
+    const char * name;
+
+    //! @brief Pointer to the data of the hardware timer
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Ticks of the measurement overhead that are subtracted from each measurement
+    uint64_t overhead;
+
+    //! @brief Number of measurements
+    uint32_t count;
+
+    //! @brief Minimum of the measured ticks, `UINT64_MAX` if there is no measurement
+    uint64_t min;
+
+    //! @brief Maximum of the measured ticks
+    uint64_t max;
+
+    //! @brief Sum of the measured ticks
+    uint64_t sum;
+
+}software_timer_stopwatch_site_t;
+
+
+//! @brief The table of all sites
+typedef struct software_timer_stopwatch_table_s
+{
+    //! @brief Storage of the sites, provided by the user
+    software_timer_stopwatch_site_t * sites;
+
+    //! @brief Number of elements of ::software_timer_stopwatch_table_s::sites
+    uint32_t capacity;
+
+    //! @brief Number of sites in use
+    uint32_t count;
+
+    //! @brief Pointer to the data of the hardware timer, used for all sites
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Ticks of the measurement overhead, see ::software_timer_stopwatch_calibrate()
+    uint64_t overhead;
+
+}software_timer_stopwatch_table_t;
+
+
+//! @brief The result of the calibration, see ::software_timer_stopwatch_calibrate()
+typedef struct software_timer_stopwatch_calibration_s
+{
+    //! @brief Minimum ticks of an empty measurement, this value is subtracted from each measurement
+    uint64_t overhead_min;
+
+    //! @brief Median ticks of an empty measurement
+    uint64_t overhead_median;
+
+    //! @brief Smallest time step in ticks that can be measured
+    uint64_t resolution_ticks;
+
+    //! @brief Smallest time step in nanoseconds that can be measured
+    uint64_t resolution_ns;
+
+}software_timer_stopwatch_calibration_t;
+
+
+//! @brief The object data of a running measurement
+typedef struct software_timer_stopwatch_s
+{
+    //! @brief The raw time at the start of the measurement
+    software_timer_timestamp_t start;
+
+    //! @brief The site that accumulates the measurement
+    software_timer_stopwatch_site_t * site;
+
+}software_timer_stopwatch_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_stopwatch can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_stopwatch_sc
+{
+    void (*Calibrate) (software_timer_stopwatch_table_t * table, uint64_t * samples, uint32_t count, software_timer_stopwatch_calibration_t * calibration);
+    uint64_t (*GetMeanNs) (const software_timer_stopwatch_site_t * site);
+    void (*Init) (software_timer_stopwatch_table_t * table, software_timer_stopwatch_site_t * sites, uint32_t capacity, const software_timer_timer_info_t * timer_info);
+    uint64_t (*Interval) (const software_timer_stopwatch_table_t * table, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end);
+    void (*Reset) (software_timer_stopwatch_table_t * table);
+    software_timer_stopwatch_site_t * (*Site) (software_timer_stopwatch_table_t * table, const char * name);
+    void (*Start) (software_timer_stopwatch_t * stopwatch, software_timer_stopwatch_site_t * site);
+    uint64_t (*Stop) (software_timer_stopwatch_t * stopwatch);
+    uint64_t (*TicksToNs) (const software_timer_timer_info_t * timer_info, uint64_t ticks);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_stopwatch_s
+extern const struct software_timer_stopwatch_sc software_timer_stopwatch;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Measures the overhead of a measurement and subtracts it from all further measurements
+//!
+//! @details Empty measurements are made back-to-back, their minimum is used as the overhead of
+//! all sites of the table, so that no measurement is reduced too much. The resolution is the
+//! smallest non-zero step between raw timestamps read back-to-back, one tick for a plain
+//! counter and more for a coarse clock. If the timer does not advance during the calibration,
+//! one tick is reported. It should be called at startup with interrupts enabled as in the
+//! later measurements.
+//!
+//! @param[in,out] table The table of the sites
+//! @param[out] samples Storage of the empty measurements, sorted afterwards
+//! @param count Number of elements of `samples`, e.g. 64
+//! @param[out] calibration The result of the calibration
+void software_timer_stopwatch_calibrate (software_timer_stopwatch_table_t * table, uint64_t * samples, uint32_t count, software_timer_stopwatch_calibration_t * calibration);
+
+//! @brief Calculates the mean time of the site in nanoseconds
+//!
+//! @param[in] site The site
+//! @return Returns the mean time, `0` if there is no measurement
+uint64_t software_timer_stopwatch_get_mean_ns (const software_timer_stopwatch_site_t * site);
+
+//! @brief Initializes an empty table
+//!
+//! @param[out] table The table of the sites
+//! @param[in] sites Storage of the sites
+//! @param capacity Number of elements of `sites`
+//! @param[in] timer_info Pointer to the data of the hardware timer
+void software_timer_stopwatch_init (software_timer_stopwatch_table_t * table, software_timer_stopwatch_site_t * sites, uint32_t capacity, const software_timer_timer_info_t * timer_info);
+
+//! @brief Calculates the ticks between two timestamps minus the measurement overhead
+//!
+//! @param[in] table The table of the sites
+//! @param[in] start The earlier timestamp
+//! @param[in] end The later timestamp
+//! @return Returns the ticks, at least `0`
+uint64_t software_timer_stopwatch_interval (const software_timer_stopwatch_table_t * table, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end);
+
+//! @brief Resets the statistics of all sites, the sites are kept
+//!
+//! @param[in,out] table The table of the sites
+void software_timer_stopwatch_reset (software_timer_stopwatch_table_t * table);
+
+//! @brief Returns the site with the name, a new site is added if it does not exist
+//!
+//! @details The names are compared with `strcmp()`, the site should therefore be looked
+//! up once and the pointer stored, e.g. in a `static` variable.
+//!
+//! @param[in,out] table The table of the sites
+//! @param[in] name The name of the site, the string must remain valid
+//! @return Returns the site or `NULL` if the table is full
+software_timer_stopwatch_site_t * software_timer_stopwatch_site (software_timer_stopwatch_table_t * table, const char * name);
+
+//! @brief Starts a measurement
+//!
+//! @param[out] stopwatch The stopwatch
+//! @param[in] site The site that accumulates the measurement
+void software_timer_stopwatch_start (software_timer_stopwatch_t * stopwatch, software_timer_stopwatch_site_t * site);
+
+//! @brief Stops the measurement and adds it to the statistics of the site
+//!
+//! @details The difference of the raw timestamps is calculated with integer arithmetic
+//! in ticks as with ::software_timer_sub_timestamp(), the overhead is subtracted.
+//!
+//! @param[in] stopwatch The stopwatch
+//! @return Returns the measured ticks minus the overhead, at least `0`
+uint64_t software_timer_stopwatch_stop (software_timer_stopwatch_t * stopwatch);
+
+//! @brief Converts the ticks of a statistic into nanoseconds for the report
+//!
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @param ticks The ticks, e.g. ::software_timer_stopwatch_site_s::max
+//! @return Returns the time in nanoseconds, see ::software_timer_get_ns()
+uint64_t software_timer_stopwatch_ticks_to_ns (const software_timer_timer_info_t * timer_info, uint64_t ticks);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+
+//! @brief Measures the lifetime of a scope with a stopwatch
+//!
+//! @details Example:
+//! @code
+//! void control_loop(void)
+//! {
+//!     static software_timer_stopwatch_site_t * site = software_timer_stopwatch_site(&table, "control_loop");
+//!     ScopedProfile profile(site);
+//!     // ...
+//! }
+//! @endcode
+class ScopedProfile
+{
+public:
+
+    //! @brief Starts the measurement, see ::software_timer_stopwatch_start()
+    //! @param[in] site The site that accumulates the measurement
+    explicit ScopedProfile(software_timer_stopwatch_site_t * site)
+    {
+        software_timer_stopwatch_start(&stopwatch, site);
+    }
+
+    //! @brief Stops the measurement, see ::software_timer_stopwatch_stop()
+    ~ScopedProfile()
+    {
+        software_timer_stopwatch_stop(&stopwatch);
+    }
+
+    ScopedProfile(const ScopedProfile &) = delete;
+    ScopedProfile & operator=(const ScopedProfile &) = delete;
+
+private:
+
+    //! @brief The running measurement
+    software_timer_stopwatch_t stopwatch;
+};
+
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_STOPWATCH_H_ */
@@ -0,0 +1,211 @@
+//! @file
+//! @brief The software_timer_timeout header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A timeout manager for many connections, e.g. of a socket server, based on a hashed timing
+//! wheel. Each bucket covers `2^resolution_shift` ticks. Timeouts are reset much more often than
+//! they expire, so ::software_timer_timeout_reset() only stores the later deadline in O(1) and
+//! leaves the entry in its bucket. When the bucket is reached, the entry is moved to the bucket
+//! of its current deadline. ::software_timer_timeout_wait_ms() returns the time until the next
+//! timeout or the next bucket to be processed, as needed by `poll()` or `epoll_wait()`.
+
+
+#ifndef INC_SOFTWARE_TIMER_TIMEOUT_H_
+#define INC_SOFTWARE_TIMER_TIMEOUT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+//! @brief Index that refers to no entry
+#define SOFTWARE_TIMER_TIMEOUT_NONE (UINT32_MAX)
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+typedef struct software_timer_timeout_s software_timer_timeout_t;
+
+
+//! @brief Function pointer type as a handler that is called after a timeout has expired
+//! @details The handler may reset or cancel any entry, also the expired one.
+typedef void (*software_timer_timeout_handler_t)(software_timer_timeout_t * manager, uint32_t index);
+
+
+//! @brief A timeout, e.g. of one connection
+typedef struct software_timer_timeout_entry_s
+{
+    //! @brief The deadline in ticks
+    uint64_t deadline;
+
+    //! @brief Bucket tick of the entry, `UINT64_MAX` if the timeout is not active
+    uint64_t scheduled;
+
+    //! @brief Next entry of the list
+    uint32_t next;
+
+    //! @brief Previous entry of the list
+    uint32_t previous;
+
+    //! @brief Optional pointer to user data, e.g. the connection, `NULL` is allowed
+    void * user_data;
+
+}software_timer_timeout_entry_t;
+
+
+//! @brief The object data of a timeout manager
+struct software_timer_timeout_s
+{
+    //! @brief Pointer to the data of the hardware timer
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Storage of the entries, provided by the user, e.g. indexed by the file descriptor
+    software_timer_timeout_entry_t * entries;
+
+    //! @brief Number of elements of ::software_timer_timeout_s::entries
+    uint32_t capacity;
+
+    //! @brief Storage of the first entry of each bucket, provided by the user
+    uint32_t * buckets;
+
+    //! @brief Number of buckets minus one, a power of two minus one
+    uint32_t mask;
+
+    //! @brief Number of ticks per bucket as power of two
+    uint32_t resolution_shift;
+
+    //! @brief First entry of the expired timeouts whose handler has not been called yet
+    uint32_t expired;
+
+    //! @brief Number of active timeouts
+    uint32_t count;
+
+    //! @brief Bucket tick up to which the wheel has been processed
+    uint64_t current;
+
+    //! @brief Function that is called after a timeout has expired, `NULL` is allowed
+    software_timer_timeout_handler_t on_timeout;
+
+};
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_timeout can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_timeout_sc
+{
+    bool (*Cancel) (software_timer_timeout_t * manager, uint32_t index);
+    uint32_t (*Expire) (software_timer_timeout_t * manager);
+    bool (*Init) (software_timer_timeout_t * manager, const software_timer_timer_info_t * timer_info, software_timer_timeout_entry_t * entries, uint32_t capacity, uint32_t * buckets, uint32_t bucket_count, uint32_t resolution_shift);
+    bool (*IsActive) (const software_timer_timeout_t * manager, uint32_t index);
+    uint64_t (*NextTimeout) (const software_timer_timeout_t * manager);
+    bool (*Reset) (software_timer_timeout_t * manager, uint32_t index, uint64_t timeout_ticks);
+    int (*WaitMs) (const software_timer_timeout_t * manager);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_timeout_s
+extern const struct software_timer_timeout_sc software_timer_timeout;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Deactivates a timeout in O(1)
+//!
+//! @param[in,out] manager The timeout manager
+//! @param index The index of the entry
+//! @retval true  when the timeout was active
+//! @retval false if the timeout was not active or the index is invalid
+bool software_timer_timeout_cancel (software_timer_timeout_t * manager, uint32_t index);
+
+//! @brief Processes the buckets up to the current time and calls the handlers of the expired timeouts
+//!
+//! @details An expired timeout is deactivated before its handler is called.
+//!
+//! @param[in,out] manager The timeout manager
+//! @return Returns the number of expired timeouts
+uint32_t software_timer_timeout_expire (software_timer_timeout_t * manager);
+
+//! @brief Initializes a manager without active timeouts
+//!
+//! @param[out] manager The timeout manager
+//! @param[in] timer_info Pointer to the data of the hardware timer, e.g. of software_timer_host.h
+//! @param[in] entries Storage of the entries
+//! @param capacity Number of elements of `entries`
+//! @param[in] buckets Storage of the buckets
+//! @param bucket_count Number of elements of `buckets`, a power of two
+//! @param resolution_shift Number of ticks per bucket as power of two, e.g. `10` for approx. 1 ms at 1 MHz
+//! @retval true  when the manager was initialized
+//! @retval false if `bucket_count` is not a power of two
+bool software_timer_timeout_init (software_timer_timeout_t * manager, const software_timer_timer_info_t * timer_info, software_timer_timeout_entry_t * entries, uint32_t capacity, uint32_t * buckets, uint32_t bucket_count, uint32_t resolution_shift);
+
+//! @brief Checks whether a timeout is active
+//!
+//! @param[in] manager The timeout manager
+//! @param index The index of the entry
+//! @return Returns `true` if the timeout is active
+bool software_timer_timeout_is_active (const software_timer_timeout_t * manager, uint32_t index);
+
+//! @brief Determines a lower bound of the ticks until the next timeout
+//!
+//! @details The deadlines of the current bucket are compared, of the later buckets only the
+//! start of the first non-empty one, so the cost does not depend on the number of entries.
+//! A wakeup at a bucket whose entries were reset lazily is early, the following
+//! ::software_timer_timeout_expire() moves them and the next call returns a later value.
+//!
+//! @param[in] manager The timeout manager
+//! @return Returns the ticks, `0` if a timeout has expired, `UINT64_MAX` if no timeout is active
+uint64_t software_timer_timeout_next_timeout (const software_timer_timeout_t * manager);
+
+//! @brief Activates a timeout or moves its deadline
+//!
+//! @details A later deadline is only stored, the entry stays in its bucket, so a reset costs
+//! O(1) without reordering. Only an earlier deadline moves the entry, also in O(1).
+//!
+//! @param[in,out] manager The timeout manager
+//! @param index The index of the entry
+//! @param timeout_ticks The ticks from now until the timeout expires, e.g. `UINT64_MAX` for a
+//! timeout that never expires in practice, the deadline is limited to `UINT64_MAX - 2`
+//! @retval true  when the timeout is active
+//! @retval false if the index is invalid
+bool software_timer_timeout_reset (software_timer_timeout_t * manager, uint32_t index, uint64_t timeout_ticks);
+
+//! @brief Determines the timeout for `poll()` or `epoll_wait()` in milliseconds
+//!
+//! @details The time is rounded up, so that the wait does not end before the next timeout.
+//!
+//! @param[in] manager The timeout manager
+//! @return Returns the milliseconds, `-1` if no timeout is active
+int software_timer_timeout_wait_ms (const software_timer_timeout_t * manager);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_TIMEOUT_H_ */
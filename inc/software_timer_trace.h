@@ -0,0 +1,213 @@
+//! @file
+//! @brief The software_timer_trace header file.
+//!
+//! @details The module can be used in C and C++ on Linux.
+//!
+//! A trace writes fixed-size records of timer events into a preallocated, memory-mapped
+//! file. A producer reserves a record with an atomic increment of the write cursor and
+//! publishes it with the sequence number written last, so several threads can write at the
+//! same time without a lock and without a system call. A reader can map the same file and
+//! tail the records while they are being written.
+
+
+#ifndef INC_SOFTWARE_TIMER_TRACE_H_
+#define INC_SOFTWARE_TIMER_TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#if defined(__linux__)
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include <stddef.h>
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+//! @brief Identifies a trace file, the characters "STTRACE1"
+#define SOFTWARE_TIMER_TRACE_MAGIC (UINT64_C(0x3145434152545453))
+
+
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief A timer event as stored in the file
+typedef struct software_timer_trace_record_s
+{
+    //! @brief Number of the record plus one, written last, `0` while the record is incomplete
+    uint32_t sequence;
+
+    //! @brief Identifier of the timer chosen by the user
+    uint32_t timer_id;
+
+    //! @brief The deadline in ticks, see ::software_timer_get_deadline_ticks()
+    uint64_t deadline_ticks;
+
+    //! @brief The time at which the timer was handled in ticks
+    uint64_t fire_ticks;
+
+    //! @brief `fire_ticks - deadline_ticks`, negative if the timer was handled early
+    int64_t lateness_ticks;
+
+}software_timer_trace_record_t;
+
+
+//! @brief The beginning of the file, followed by the records
+typedef struct software_timer_trace_header_s
+{
+    //! @brief ::SOFTWARE_TIMER_TRACE_MAGIC
+    uint64_t magic;
+
+    //! @brief Size of a record in bytes
+    uint32_t record_size;
+
+    //! @brief Number of records of the file
+    uint32_t capacity;
+
+    //! @brief Number of reserved records, can be greater than the capacity
+    uint64_t cursor;
+
+    //! @brief The ticks per second of the hardware timer, for the conversion by the reader
+    uint64_t ticks_per_second;
+
+}software_timer_trace_header_t;
+
+
+//! @brief The object data of a trace writer or reader
+typedef struct software_timer_trace_s
+{
+    //! @brief The mapped file
+    software_timer_trace_header_t * header;
+
+    //! @brief The records behind the header
+    software_timer_trace_record_t * records;
+
+    //! @brief Size of the mapping in bytes
+    size_t size;
+
+    //! @brief The file descriptor, `-1` if not open
+    int file;
+
+    //! @brief Pointer to the data of the hardware timer, `NULL` for a reader
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Number of the next record of a reader
+    uint32_t position;
+
+}software_timer_trace_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_trace can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_trace_sc
+{
+    void (*Close) (software_timer_trace_t * trace);
+    bool (*Create) (software_timer_trace_t * trace, const char * path, uint32_t capacity, const software_timer_timer_info_t * timer_info);
+    uint64_t (*Dropped) (const software_timer_trace_t * trace);
+    bool (*Next) (software_timer_trace_t * trace, software_timer_trace_record_t * record);
+    bool (*Open) (software_timer_trace_t * trace, const char * path);
+    bool (*Record) (software_timer_trace_t * trace, uint32_t timer_id, uint64_t deadline_ticks, uint64_t fire_ticks);
+    bool (*RecordTimer) (software_timer_trace_t * trace, uint32_t timer_id, const software_timer_t * timer);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_trace_s
+extern const struct software_timer_trace_sc software_timer_trace;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Unmaps and closes the file, the records written so far remain in it
+//!
+//! @param[in,out] trace The trace
+void software_timer_trace_close (software_timer_trace_t * trace);
+
+//! @brief Creates or truncates the file, allocates it for all records and maps it
+//!
+//! @param[out] trace The trace writer
+//! @param[in] path The path of the file
+//! @param capacity Number of records
+//! @param[in] timer_info Pointer to the data of the hardware timer
+//! @retval true  when the file is ready
+//! @retval false if a system call failed, `errno` is set
+bool software_timer_trace_create (software_timer_trace_t * trace, const char * path, uint32_t capacity, const software_timer_timer_info_t * timer_info);
+
+//! @brief Returns the number of records that did not fit into the file
+//!
+//! @param[in] trace The trace
+//! @return Returns the number of dropped records
+uint64_t software_timer_trace_dropped (const software_timer_trace_t * trace);
+
+//! @brief Reads the next published record
+//!
+//! @details The function returns `false` as long as the next record has not been published
+//! yet, it can be called again later to tail a file that is still being written.
+//!
+//! @param[in,out] trace The trace reader
+//! @param[out] record The record
+//! @retval true  when a record was read
+//! @retval false if there is no further record at the moment
+bool software_timer_trace_next (software_timer_trace_t * trace, software_timer_trace_record_t * record);
+
+//! @brief Maps an existing file for reading, it may still be written by another process
+//!
+//! @param[out] trace The trace reader
+//! @param[in] path The path of the file
+//! @retval true  when the file is ready
+//! @retval false if a system call failed or the file is not a trace
+bool software_timer_trace_open (software_timer_trace_t * trace, const char * path);
+
+//! @brief Appends a record without a lock and without a system call
+//!
+//! @param[in,out] trace The trace writer
+//! @param timer_id Identifier of the timer
+//! @param deadline_ticks The deadline in ticks
+//! @param fire_ticks The time at which the timer was handled in ticks
+//! @retval true  when the record was written
+//! @retval false if the file is full, the record is counted as dropped
+bool software_timer_trace_record (software_timer_trace_t * trace, uint32_t timer_id, uint64_t deadline_ticks, uint64_t fire_ticks);
+
+//! @brief Appends a record with the deadline of the timer and the current time
+//!
+//! @details It is intended for the handler ::software_timer_s::on_tick, which is called
+//! before the timer is restarted, so the deadline is the one that has just expired.
+//!
+//! @param[in,out] trace The trace writer
+//! @param timer_id Identifier of the timer
+//! @param[in] timer The timer
+//! @retval true  when the record was written
+//! @retval false if the file is full
+bool software_timer_trace_record_timer (software_timer_trace_t * trace, uint32_t timer_id, const software_timer_t * timer);
+
+
+#endif /* defined(__linux__) */
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_TRACE_H_ */
@@ -0,0 +1,121 @@
+//! @file
+//! @brief The software_timer_varint header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! Variable-length integers for compact binary streams of ticks. A value is stored in
+//! little-endian groups of 7 bits, the highest bit of a byte is set if another byte
+//! follows, so small values need one byte and `UINT64_MAX` needs ten. Signed values are
+//! mapped with the zigzag encoding, so that small negative values are short as well.
+//! All functions are static inline, there is no source file.
+
+
+#ifndef INC_SOFTWARE_TIMER_VARINT_H_
+#define INC_SOFTWARE_TIMER_VARINT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include <stddef.h>
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+
+//! @brief Maximum number of bytes of an encoded 64-bit value
+#define SOFTWARE_TIMER_VARINT_MAX_BYTES (10)
+
+
+/*---------------------------------------------------------------------*
+ *  public: static inline functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Reads a value
+//!
+//! @param[in] buffer The encoded bytes
+//! @param size Number of available bytes
+//! @param[out] value The decoded value
+//! @return Returns the number of read bytes, `0` if the value is incomplete or too long
+static INLINE size_t software_timer_varint_read (const uint8_t * buffer, size_t size, uint64_t * value)
+{
+    uint64_t result = 0;
+
+    for(size_t index = 0; index < size && index < SOFTWARE_TIMER_VARINT_MAX_BYTES; ++index)
+    {
+        uint8_t byte = buffer[index];
+        result |= (uint64_t)(byte & 0x7F) << (7 * index);
+
+        if(0 == (byte & 0x80))
+        {
+            *value = result;
+            return index + 1;
+        }
+    }
+
+    return 0;
+}
+
+//! @brief Writes a value
+//!
+//! @param[out] buffer The destination of the encoded bytes
+//! @param capacity Number of free bytes
+//! @param value The value
+//! @return Returns the number of written bytes, `0` if there is not enough space
+static INLINE size_t software_timer_varint_write (uint8_t * buffer, size_t capacity, uint64_t value)
+{
+    size_t index = 0;
+
+    do
+    {
+        if(index >= capacity)
+        {
+            return 0;
+        }
+
+        uint8_t byte = (uint8_t)(value & 0x7F);
+        value >>= 7;
+        buffer[index++] = (uint8_t)(byte | ((0 != value) ? 0x80 : 0x00));
+
+    }while(0 != value);
+
+    return index;
+}
+
+//! @brief Maps a signed value to an unsigned one, `0, -1, 1, -2` become `0, 1, 2, 3`
+//!
+//! @param value The signed value
+//! @return Returns the unsigned value
+static INLINE uint64_t software_timer_varint_zigzag_encode (int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(0 - (uint64_t)(value < 0));
+}
+
+//! @brief Reverses ::software_timer_varint_zigzag_encode()
+//!
+//! @param value The unsigned value
+//! @return Returns the signed value
+static INLINE int64_t software_timer_varint_zigzag_decode (uint64_t value)
+{
+    return (int64_t)((value >> 1) ^ (0 - (value & 1)));
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_VARINT_H_ */
@@ -0,0 +1,171 @@
+//! @file
+//! @brief The software_timer_virtual header file.
+//!
+//! @details The module can be used in C and C++.
+//!
+//! A virtual clock replaces the hardware timer for simulations and tests. The clock
+//! owns the `counter` and `overflows` of a ::software_timer_timer_info_t and advances them
+//! directly to the earliest deadline of the registered timers instead of tick by tick,
+//! so hours of simulated time run in milliseconds.
+
+
+#ifndef INC_SOFTWARE_TIMER_VIRTUAL_H_
+#define INC_SOFTWARE_TIMER_VIRTUAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer.h"
+
+
+/*---------------------------------------------------------------------*
+ *  public: define
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief The object data of a virtual clock
+typedef struct software_timer_virtual_s
+{
+    //! @brief The simulated hardware counter, ::software_timer_timer_info_s::counter points to it
+    volatile uint16_t counter;
+
+    //! @brief The simulated overflows, ::software_timer_timer_info_s::overflows points to it
+    volatile uint64_t overflows;
+
+    //! @brief Pointer to the data of the simulated hardware timer
+    const software_timer_timer_info_t * timer_info;
+
+    //! @brief Storage of the registered timers, provided by the user
+    software_timer_t ** timers;
+
+    //! @brief Number of elements of ::software_timer_virtual_s::timers
+    uint32_t capacity;
+
+    //! @brief Number of registered timers
+    uint32_t count;
+
+}software_timer_virtual_t;
+
+
+//! @brief Represents a simplified form of a class
+//! @details The global variable ::software_timer_virtual can be used to easily access all matching
+//! functions with auto-completion.
+struct software_timer_virtual_sc
+{
+    void (*Advance) (software_timer_virtual_t * clock, uint64_t ticks);
+    software_timer_timer_info_flag_t (*Init) (software_timer_virtual_t * clock, software_timer_timer_info_t * timer_info, software_timer_t ** timers, uint32_t capacity);
+    uint64_t (*NextDeadline) (const software_timer_virtual_t * clock);
+    uint64_t (*Now) (const software_timer_virtual_t * clock);
+    bool (*Register) (software_timer_virtual_t * clock, software_timer_t * timer);
+    uint64_t (*RunUntil) (software_timer_virtual_t * clock, uint64_t ticks);
+    void (*SetTicks) (software_timer_virtual_t * clock, uint64_t ticks);
+    uint64_t (*Step) (software_timer_virtual_t * clock);
+    bool (*Unregister) (software_timer_virtual_t * clock, software_timer_t * timer);
+};
+
+
+/*---------------------------------------------------------------------*
+ *  public: extern variables
+ *---------------------------------------------------------------------*/
+
+//! @brief To access all member functions working with type ::software_timer_virtual_s
+extern const struct software_timer_virtual_sc software_timer_virtual;
+
+
+/*---------------------------------------------------------------------*
+ *  public: function prototypes
+ *---------------------------------------------------------------------*/
+
+//! @brief Advances the virtual time by a number of ticks
+//!
+//! @param[in,out] clock The virtual clock
+//! @param ticks The number of ticks
+void software_timer_virtual_advance (software_timer_virtual_t * clock, uint64_t ticks);
+
+//! @brief Initializes the virtual clock at time 0 and connects it to the timer data
+//!
+//! @details ::software_timer_timer_info_s::counter and ::software_timer_timer_info_s::overflows
+//! are set to the clock, then ::software_timer_timer_info_init() is called. The fields
+//! `capture_compare`, `prescaler` and `ticks_per_second` must be set before.
+//!
+//! @param[out] clock The virtual clock
+//! @param[in,out] timer_info Pointer to the data of the simulated hardware timer
+//! @param[in] timers Storage of the registered timers
+//! @param capacity Number of elements of `timers`
+//! @return Returns the flags of ::software_timer_timer_info_init()
+software_timer_timer_info_flag_t software_timer_virtual_init (software_timer_virtual_t * clock, software_timer_timer_info_t * timer_info, software_timer_t ** timers, uint32_t capacity);
+
+//! @brief Determines the earliest deadline of all registered timers including their slack
+//!
+//! @param[in] clock The virtual clock
+//! @return Returns the ticks, `UINT64_MAX` if no timer is running
+uint64_t software_timer_virtual_next_deadline (const software_timer_virtual_t * clock);
+
+//! @brief Returns the current virtual time
+//!
+//! @param[in] clock The virtual clock
+//! @return Returns the ticks, see ::software_timer_get_ticks()
+uint64_t software_timer_virtual_now (const software_timer_virtual_t * clock);
+
+//! @brief Registers a timer, so that the clock can jump to its deadline
+//!
+//! @param[in,out] clock The virtual clock
+//! @param[in] timer The timer, it must use the timer data of the clock
+//! @retval true  when the timer was registered
+//! @retval false if the storage is full
+bool software_timer_virtual_register (software_timer_virtual_t * clock, software_timer_t * timer);
+
+//! @brief Runs the simulation until the given time
+//!
+//! @details The clock jumps from deadline to deadline. At each deadline all registered timers
+//! are checked with ::software_timer_elapsed(), so their handlers are called. A handler may
+//! start and stop other timers. A timer that is still due after its check, e.g. without a
+//! duration, expires once per tick. Finally the clock is set to `ticks`.
+//!
+//! @param[in,out] clock The virtual clock
+//! @param ticks The end time of the simulation
+//! @return Returns the number of expired timers
+uint64_t software_timer_virtual_run_until (software_timer_virtual_t * clock, uint64_t ticks);
+
+//! @brief Sets the virtual time
+//!
+//! @param[in,out] clock The virtual clock
+//! @param ticks The time in ticks, see ::software_timer_set_ticks()
+void software_timer_virtual_set_ticks (software_timer_virtual_t * clock, uint64_t ticks);
+
+//! @brief Jumps to the earliest deadline of all registered timers
+//!
+//! @details The time is not changed if the deadline has already been reached or no timer is running.
+//! The timers are not checked, this is left to the caller.
+//!
+//! @param[in,out] clock The virtual clock
+//! @return Returns the earliest deadline, `UINT64_MAX` if no timer is running
+uint64_t software_timer_virtual_step (software_timer_virtual_t * clock);
+
+//! @brief Removes a registered timer
+//!
+//! @param[in,out] clock The virtual clock
+//! @param[in] timer The timer
+//! @retval true  when the timer was removed
+//! @retval false if the timer is not registered
+bool software_timer_virtual_unregister (software_timer_virtual_t * clock, software_timer_t * timer);
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_SOFTWARE_TIMER_VIRTUAL_H_ */
@@ -14,9 +14,21 @@
 /*---------------------------------------------------------------------*
  *  private: definitions
  *---------------------------------------------------------------------*/
+
+//! @brief Nanoseconds per second
+#define SOFTWARE_TIMER_NS_PER_SECOND UINT64_C(1000000000)
+
 /*---------------------------------------------------------------------*
  *  private: typedefs
  *---------------------------------------------------------------------*/
+
+#if defined(__SIZEOF_INT128__)
+
+//! @brief Unsigned 128-bit integer of GCC and Clang, `__extension__` keeps `-Wpedantic` quiet
+__extension__ typedef unsigned __int128 software_timer_uint128_t;
+
+#endif
+
 /*---------------------------------------------------------------------*
  *  private: variables
  *---------------------------------------------------------------------*/
@@ -28,20 +40,44 @@ const struct software_timer_sc software_timer =
 {
     software_timer_calculate_and_set_duration,
     software_timer_calculate_duration,
+    software_timer_convert_ticks,
     software_timer_elapsed,
     software_timer_elapsed_once,
     software_timer_elapsed_prevent_multiple_triggers,
+    software_timer_expire,
+    software_timer_get_deadline_ticks,
     software_timer_get_duration,
+    software_timer_get_end_ticks,
+    software_timer_get_ns,
+    software_timer_get_ticks,
     software_timer_get_time,
     software_timer_get_timespec,
+    software_timer_get_timespec_integer,
     software_timer_get_timestamp,
     software_timer_init_halt,
+    software_timer_is_paused,
     software_timer_is_running,
     software_timer_is_stopped,
+    software_timer_pause,
+    software_timer_pause_at,
+    software_timer_rescale,
+    software_timer_restart,
+    software_timer_resume,
+    software_timer_resume_at,
+    software_timer_resync,
+    software_timer_resync_at,
     software_timer_set_duration,
+    software_timer_set_slack,
+    software_timer_set_ticks,
     software_timer_start,
+    software_timer_start_aligned,
+    software_timer_start_at,
+    software_timer_start_batch,
+    software_timer_start_batch_at,
     software_timer_stop,
     software_timer_sub_timestamp,
+    software_timer_timer_info_get_timestamp,
+    software_timer_timer_info_init,
 
 };
 
@@ -49,9 +85,262 @@ const struct software_timer_sc software_timer =
 /*---------------------------------------------------------------------*
  *  private: function prototypes
  *---------------------------------------------------------------------*/
+
+static uint64_t software_timer_mul_high (uint64_t a, uint64_t b);
+static uint64_t software_timer_mul_div (uint64_t a, uint64_t b, uint64_t divisor);
+static uint8_t software_timer_log2 (uint64_t value);
+static void software_timer_reciprocal (uint64_t divisor, uint64_t * mult, uint8_t * shift);
+static INLINE uint64_t software_timer_div (uint64_t value, uint64_t divisor, uint64_t mult, uint8_t shift, uint64_t * remainder);
+static INLINE void software_timer_read (const software_timer_timer_info_t * timer_info, uint16_t * counter, uint64_t * overflows);
+static INLINE uint64_t software_timer_apply_slack (uint64_t deadline, uint32_t slack);
+static INLINE bool software_timer_is_due (const software_timer_t * object, uint16_t counter, uint64_t overflows);
+static INLINE void software_timer_start_from (software_timer_t * object, uint16_t counter, uint64_t overflows);
+
+
 /*---------------------------------------------------------------------*
  *  private: functions
  *---------------------------------------------------------------------*/
+
+//! @brief Calculates the upper 64 bits of the 128-bit product `a * b`
+static uint64_t software_timer_mul_high (uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+
+    return (uint64_t)(((software_timer_uint128_t)a * b) >> 64);
+
+#else
+
+    // Schoolbook multiplication with 32-bit halves, the carry of the
+    // middle terms is collected in `middle` so that nothing is lost.
+
+    uint64_t a_low = (uint32_t)a;
+    uint64_t a_high = a >> 32;
+    uint64_t b_low = (uint32_t)b;
+    uint64_t b_high = b >> 32;
+
+    uint64_t low_low = a_low * b_low;
+    uint64_t high_low = a_high * b_low;
+    uint64_t low_high = a_low * b_high;
+    uint64_t high_high = a_high * b_high;
+
+    uint64_t middle = (low_low >> 32) + (uint32_t)high_low + (uint32_t)low_high;
+
+    return high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+
+#endif
+}
+
+//! @brief Calculates `a * b / divisor` rounded down with a 128-bit intermediate result
+//!
+//! @details A result that does not fit into 64 bits is saturated to `UINT64_MAX`.
+//! The function is not used in the hot paths.
+static uint64_t software_timer_mul_div (uint64_t a, uint64_t b, uint64_t divisor)
+{
+#if defined(__SIZEOF_INT128__)
+
+    software_timer_uint128_t quotient = ((software_timer_uint128_t)a * b) / divisor;
+
+    return (quotient > UINT64_MAX) ? UINT64_MAX : (uint64_t)quotient;
+
+#else
+
+    uint64_t high = software_timer_mul_high(a, b);
+    uint64_t low = a * b;
+
+    // The quotient fits into 64 bits only if the high part is smaller than the divisor
+    if(high >= divisor)
+    {
+        return UINT64_MAX;
+    }
+
+    // Bitwise long division, the remainder is always smaller than the divisor.
+    // If the remainder overflows while shifting, it is in any case greater
+    // than the divisor and the modular subtraction delivers the right value.
+
+    uint64_t remainder = 0;
+    uint64_t quotient = 0;
+
+    for(int bit = 127; bit >= 0; --bit)
+    {
+        uint64_t carry = remainder >> 63;
+        remainder = (remainder << 1) | (((bit >= 64 ? high : low) >> (bit & 63)) & 1);
+        quotient <<= 1;
+
+        if(carry || remainder >= divisor)
+        {
+            remainder -= divisor;
+            quotient |= 1;
+        }
+    }
+
+    return quotient;
+
+#endif
+}
+
+//! @brief Calculates the logarithm to base two rounded down, `value` must not be `0`
+static uint8_t software_timer_log2 (uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return (uint8_t)(63 - __builtin_clzll(value));
+
+#else
+
+    uint8_t result = 0;
+
+    while(value >>= 1)
+    {
+        ++result;
+    }
+
+    return result;
+
+#endif
+}
+
+//! @brief Calculates the multiplier `2^(64 + shift) / divisor` for ::software_timer_div()
+//!
+//! @details The multiplier is normalized so that the highest bit is set, with a power
+//! of two the shift is reduced by one. The divisor `1` cannot be normalized and uses
+//! `UINT64_MAX` instead of 2^64. The divisor must not be `0`.
+static void software_timer_reciprocal (uint64_t divisor, uint64_t * mult, uint8_t * shift)
+{
+    uint8_t result_shift = software_timer_log2(divisor);
+
+    if((result_shift > 0) && (0 == (divisor & (divisor - 1))))
+    {
+        --result_shift;
+    }
+
+    uint64_t remainder = 1;
+    uint64_t result_mult = 0;
+
+    for(int bit = 0; bit < 64 + result_shift; ++bit)
+    {
+        uint64_t carry = remainder >> 63;
+        remainder <<= 1;
+        result_mult <<= 1;
+
+        if(carry || remainder >= divisor)
+        {
+            remainder -= divisor;
+            result_mult |= 1;
+        }
+    }
+
+    *mult = (1 == divisor) ? UINT64_MAX : result_mult;
+    *shift = result_shift;
+}
+
+//! @brief Divides `value` by `divisor` with the multiplier of ::software_timer_reciprocal()
+//!
+//! @details The estimate is at most one too small and is corrected, so the result is exact.
+static INLINE uint64_t software_timer_div (uint64_t value, uint64_t divisor, uint64_t mult, uint8_t shift, uint64_t * remainder)
+{
+    uint64_t quotient = software_timer_mul_high(value, mult) >> shift;
+    uint64_t rest = value - quotient * divisor;
+
+    if(rest >= divisor)
+    {
+        ++quotient;
+        rest -= divisor;
+    }
+
+    *remainder = rest;
+    return quotient;
+}
+
+//! @brief Reads the hardware timer values
+//!
+//! @details The `overflows` and `counter` read operations are not thread/interrupt safe.
+//! By reading in twice, it is possible to check whether there was
+//! an overflow and, if so, to read in the correct value.
+static INLINE void software_timer_read (const software_timer_timer_info_t * timer_info, uint16_t * counter, uint64_t * overflows)
+{
+    volatile uint64_t * overflows_ptr = timer_info->overflows;
+    volatile uint16_t * counter_ptr = timer_info->counter;
+
+    uint16_t counter_a = *counter_ptr;
+    uint64_t overflows_b = *overflows_ptr;
+    uint16_t counter_b = *counter_ptr;
+    if(counter_b < counter_a)
+    {
+        overflows_b = *overflows_ptr;
+    }
+
+    *counter = counter_b;
+    *overflows = overflows_b;
+}
+
+
+//! @brief Moves the deadline within `[deadline, deadline + slack]` to the value with the
+//! most trailing zero bits, as the Linux kernel does for `timer_slack_ns`
+static INLINE uint64_t software_timer_apply_slack (uint64_t deadline, uint32_t slack)
+{
+    uint64_t limit = deadline + slack;
+    uint64_t mask = deadline ^ limit;
+
+    if(0 == mask || limit < deadline)
+    {
+        return deadline;
+    }
+
+    mask = (UINT64_C(1) << software_timer_log2(mask)) - 1;
+
+    return limit & ~mask;
+}
+
+//! @brief Checks whether the end value of the timer has been reached at the given time
+static INLINE bool software_timer_is_due (const software_timer_t * object, uint16_t counter, uint64_t overflows)
+{
+    uint64_t end_overflows = object->end_overflows;
+    uint32_t end_counter = object->end_counter;
+
+    if(0 == object->slack)
+    {
+        return ((counter >= end_counter) && (overflows == end_overflows)) || (overflows > end_overflows);
+    }
+
+    if(UINT64_MAX == end_overflows)
+    {
+        return false;
+    }
+
+    software_timer_timestamp_t timestamp;
+    timestamp.timer_info = object->timer_info;
+
+    timestamp.counter = counter;
+    timestamp.overflows = overflows;
+    uint64_t ticks = software_timer_get_ticks(&timestamp);
+
+    timestamp.counter = (uint16_t)end_counter;
+    timestamp.overflows = end_overflows;
+    uint64_t deadline = software_timer_apply_slack(software_timer_get_ticks(&timestamp), object->slack);
+
+    return ticks >= deadline;
+}
+
+//! @brief Sets the end value of the timer to the given time plus the duration
+static INLINE void software_timer_start_from (software_timer_t * object, uint16_t counter, uint64_t overflows)
+{
+    uint32_t end_counter = (uint32_t)counter + object->duration_counter;
+    overflows += object->duration_overflows;
+
+    uint32_t period = object->timer_info->period;
+
+    if( period <= end_counter )
+    {
+        overflows += 1;
+        end_counter -= period;
+    }
+
+    object->end_overflows = overflows;
+    object->end_counter = (uint16_t)end_counter;
+    object->paused_ticks = 0;
+}
+
+
 /*---------------------------------------------------------------------*
  *  public:  functions
  *---------------------------------------------------------------------*/
@@ -95,7 +384,7 @@ software_timer_duration_flag_t software_timer_calculate_duration (const software
         // the second and third cast removes the warning that accuracy could be lost with the cast
         double next_duration_counter =
             ( time_in_seconds * (double)ticks_per_second ) -
-            ( (double)duration_overflows * (( (uint32_t)timer_info->capture_compare) + 1));
+            ( (double)duration_overflows * timer_info->period);
 
         duration_counter = (uint16_t)next_duration_counter;
 
@@ -117,6 +406,32 @@ software_timer_duration_flag_t software_timer_calculate_duration (const software
     return flags;
 }
 
+uint64_t software_timer_convert_ticks (uint64_t ticks, const software_timer_timer_info_t * from, const software_timer_timer_info_t * to)
+{
+    uint64_t from_ticks_per_second = from->ticks_per_second;
+    uint64_t to_ticks_per_second = to->ticks_per_second;
+
+    if(0 == from_ticks_per_second || 0 == to_ticks_per_second)
+    {
+        return 0;
+    }
+
+    if(from_ticks_per_second == to_ticks_per_second)
+    {
+        return ticks;
+    }
+
+    uint64_t result = software_timer_mul_div(ticks, to_ticks_per_second, from_ticks_per_second);
+
+    // The division is exact if the low 64 bits of both products match
+    if(UINT64_MAX != result && result * from_ticks_per_second != ticks * to_ticks_per_second)
+    {
+        result += 1;
+    }
+
+    return result;
+}
+
 bool software_timer_elapsed (software_timer_t *object)
 {
     const software_timer_timer_info_t * const timer_info = object->timer_info;
@@ -151,33 +466,9 @@ bool software_timer_elapsed (software_timer_t *object)
 
 #endif
 
-    uint64_t end_overflows = object->end_overflows;
-    uint32_t end_counter = object->end_counter;
-
-    if(((counter >= end_counter) && (overflows == end_overflows)) || (overflows > end_overflows))
+    if(software_timer_is_due(object, counter, overflows))
     {
-        if(NULL != object->on_tick) { object->on_tick(object); }
-
-        uint16_t duration_counter = object->duration_counter;
-        uint64_t duration_overflows = object->duration_overflows;
-
-        end_counter += duration_counter;
-        end_overflows += duration_overflows;
-
-        uint32_t capture_compare = (uint32_t)timer_info->capture_compare + 1;
-
-        if( capture_compare <= end_counter )
-        {
-            end_overflows += 1;
-            end_counter -= capture_compare;
-        }
-
-        // ---- ---- ---- ----
-
-        object->end_overflows = end_overflows;
-        object->end_counter = (uint16_t)end_counter;
-
-        return true;
+        return software_timer_expire(object);
     }
     else
     {
@@ -209,14 +500,12 @@ bool software_timer_elapsed_once (software_timer_t *object)
 
 #endif
 
-    uint64_t end_overflows = object->end_overflows;
-    uint32_t end_counter = object->end_counter;
-
-    if(((counter >= end_counter) && (overflows == end_overflows)) || (overflows > end_overflows))
+    if(software_timer_is_due(object, counter, overflows))
     {
         if(NULL != object->on_tick) { object->on_tick(object); }
 
         object->end_overflows = UINT64_MAX;
+        object->paused_ticks = 0;
 
         return true;
     }
@@ -253,7 +542,7 @@ bool software_timer_elapsed_prevent_multiple_triggers (software_timer_t *object)
     uint64_t end_overflows = object->end_overflows;
     uint32_t end_counter = object->end_counter;
 
-    if(((counter >= end_counter) && (overflows == end_overflows)) || (overflows > end_overflows))
+    if(software_timer_is_due(object, counter, overflows))
     {
         if(NULL != object->on_tick) { object->on_tick(object); }
 
@@ -263,20 +552,20 @@ bool software_timer_elapsed_prevent_multiple_triggers (software_timer_t *object)
         end_counter += duration_counter;
         end_overflows += duration_overflows;
 
-        uint32_t capture_compare = (uint32_t)timer_info->capture_compare + 1;
+        uint32_t period = timer_info->period;
 
-        if( capture_compare <= end_counter )
+        if( period <= end_counter )
         {
             end_overflows += 1;
-            end_counter -= capture_compare;
+            end_counter -= period;
         }
 
         // ---- ---- ---- ----
 
         if(((counter >= end_counter) && (overflows == end_overflows)) || (overflows > end_overflows))
         {
-            double duration_current = ((double)capture_compare) * (double)(overflows - end_overflows) + ((double)counter - (double)end_counter);
-            double duration = (double)capture_compare * (double)duration_overflows + duration_counter;
+            double duration_current = ((double)period) * (double)(overflows - end_overflows) + ((double)counter - (double)end_counter);
+            double duration = (double)period * (double)duration_overflows + duration_counter;
 
             if(0 != duration)
             {
@@ -284,12 +573,12 @@ bool software_timer_elapsed_prevent_multiple_triggers (software_timer_t *object)
                 uint64_t duration_target_per_CC = (uint64_t)(duration_target * timer_info->capture_compare_inverse);
 
                 end_overflows = duration_target_per_CC + end_overflows;
-                end_counter = (uint16_t)(duration_target - ((double)duration_target_per_CC * (double)capture_compare)) + end_counter;
+                end_counter = (uint16_t)(duration_target - ((double)duration_target_per_CC * (double)period)) + end_counter;
 
-                if( capture_compare <= end_counter )
+                if( period <= end_counter )
                 {
                     end_overflows += 1;
-                    end_counter -= capture_compare;
+                    end_counter -= period;
                 }
             }
         }
@@ -307,6 +596,34 @@ bool software_timer_elapsed_prevent_multiple_triggers (software_timer_t *object)
     }
 }
 
+bool software_timer_expire (software_timer_t * object)
+{
+    if(software_timer_is_stopped(object))
+    {
+        return false;
+    }
+
+    uint64_t end_overflows = object->end_overflows;
+    uint16_t end_counter = object->end_counter;
+
+    if(NULL != object->on_tick) { object->on_tick(object); }
+
+    // The end value was read before the handler, so the timer is restarted without drift
+    software_timer_start_from(object, end_counter, end_overflows);
+
+    return true;
+}
+
+uint64_t software_timer_get_deadline_ticks (const software_timer_t * object)
+{
+    if(software_timer_is_stopped(object))
+    {
+        return UINT64_MAX;
+    }
+
+    return software_timer_apply_slack(software_timer_get_end_ticks(object), object->slack);
+}
+
 void software_timer_get_duration (const software_timer_t * object, software_timer_duration_t * duration)
 {
     duration->time_in_seconds = object->time_in_seconds;
@@ -315,6 +632,64 @@ void software_timer_get_duration (const software_timer_t * object, software_time
     duration->duration_overflows = object->duration_overflows;
 }
 
+uint64_t software_timer_get_end_ticks (const software_timer_t * object)
+{
+    if(software_timer_is_stopped(object))
+    {
+        return UINT64_MAX;
+    }
+
+    software_timer_timestamp_t timestamp;
+    timestamp.counter = object->end_counter;
+    timestamp.overflows = object->end_overflows;
+    timestamp.timer_info = object->timer_info;
+
+    return software_timer_get_ticks(&timestamp);
+}
+
+uint64_t software_timer_get_ns (const software_timer_timestamp_t * timestamp)
+{
+    const software_timer_timer_info_t * const timer_info = timestamp->timer_info;
+
+    uint64_t ticks_per_second = timer_info->ticks_per_second;
+    uint64_t ticks = software_timer_get_ticks(timestamp);
+
+    uint64_t remainder;
+    uint64_t seconds = software_timer_div(ticks, ticks_per_second, timer_info->seconds_mult, timer_info->seconds_shift, &remainder);
+
+    uint64_t nanoseconds;
+
+    if(0 != timer_info->nanoseconds_mult)
+    {
+        // The estimate is at most one nanosecond too small,
+        // `remainder` is smaller than 2^32 and the products fit into 64 bits
+        nanoseconds = (remainder * timer_info->nanoseconds_mult) >> timer_info->nanoseconds_shift;
+
+        if((nanoseconds + 1) * ticks_per_second <= remainder * SOFTWARE_TIMER_NS_PER_SECOND)
+        {
+            ++nanoseconds;
+        }
+    }
+    else
+    {
+        nanoseconds = software_timer_mul_div(remainder, SOFTWARE_TIMER_NS_PER_SECOND, ticks_per_second);
+    }
+
+    return seconds * SOFTWARE_TIMER_NS_PER_SECOND + nanoseconds;
+}
+
+uint64_t software_timer_get_ticks (const software_timer_timestamp_t * timestamp)
+{
+    const software_timer_timer_info_t * const timer_info = timestamp->timer_info;
+
+    if(timer_info->period_is_power_of_two)
+    {
+        return (timestamp->overflows << timer_info->period_shift) | timestamp->counter;
+    }
+
+    return timestamp->overflows * timer_info->period + timestamp->counter;
+}
+
 double software_timer_get_time (const software_timer_timestamp_t * timestamp)
 {
     const software_timer_timer_info_t * const timer_info = timestamp->timer_info;
@@ -324,7 +699,7 @@ double software_timer_get_time (const software_timer_timestamp_t * timestamp)
 
     // @info: The first variable is double and must be double because the calculation can exceed 64 bits,
     // the second cast removes the warning that accuracy could be lost with the cast
-    double overflow = ( seconds_per_tick * (double)timestamp->overflows * ( (uint32_t)timer_info->capture_compare + 1));
+    double overflow = ( seconds_per_tick * (double)timestamp->overflows * timer_info->period);
 
     return overflow + counter;
 }
@@ -385,26 +760,17 @@ void software_timer_get_timespec (const software_timer_timestamp_t * timestamp,
 #endif
 }
 
-void software_timer_get_timestamp (const software_timer_t * object, software_timer_timestamp_t * timestamp)
+void software_timer_get_timespec_integer (const software_timer_timestamp_t * timestamp, struct timespec * result_timespec)
 {
-    const software_timer_timer_info_t * const timer_info = object->timer_info;
-    volatile uint64_t * overflows_ptr = timer_info->overflows;
-    volatile uint16_t * counter_ptr = timer_info->counter;
+    uint64_t nanoseconds = software_timer_get_ns(timestamp);
 
-    // The `overflows` and `counter` read operations are not thread/interrupt safe.
-    // By reading in twice, it is possible to check whether there was
-    // an overflow and, if so, to read in the correct value.
-    uint16_t counter_a = *counter_ptr;
-    uint64_t overflows = *overflows_ptr;
-    uint16_t counter = *counter_ptr;
-    if(counter < counter_a)
-    {
-        overflows = *overflows_ptr;
-    }
+    result_timespec->tv_sec = (time_t)(nanoseconds / SOFTWARE_TIMER_NS_PER_SECOND);
+    result_timespec->tv_nsec = (long)(nanoseconds % SOFTWARE_TIMER_NS_PER_SECOND);
+}
 
-    timestamp->counter = counter;
-    timestamp->overflows = overflows;
-    timestamp->timer_info = timer_info;
+void software_timer_get_timestamp (const software_timer_t * object, software_timer_timestamp_t * timestamp)
+{
+    software_timer_timer_info_get_timestamp(object->timer_info, timestamp);
 }
 
 void software_timer_init_halt (software_timer_t * object, const software_timer_timer_info_t * const timer_info)
@@ -418,6 +784,13 @@ void software_timer_init_halt (software_timer_t * object, const software_timer_t
     object->timer_info = timer_info;
     object->on_tick = NULL;
     object->user_data = NULL;
+    object->slack = 0;
+    object->paused_ticks = 0;
+}
+
+bool software_timer_is_paused (const software_timer_t * object)
+{
+    return software_timer_is_stopped(object) && (0 != object->paused_ticks);
 }
 
 bool software_timer_is_running (const software_timer_t * object)
@@ -430,6 +803,184 @@ bool software_timer_is_stopped (const software_timer_t * object)
     return UINT64_MAX == object->end_overflows;
 }
 
+bool software_timer_pause (software_timer_t * object)
+{
+    if(software_timer_is_stopped(object))
+    {
+        return false;
+    }
+
+    software_timer_timestamp_t timestamp;
+    software_timer_get_timestamp(object, &timestamp);
+
+    return software_timer_pause_at(object, &timestamp);
+}
+
+bool software_timer_pause_at (software_timer_t * object, const software_timer_timestamp_t * timestamp)
+{
+    if(software_timer_is_stopped(object))
+    {
+        return false;
+    }
+
+    software_timer_timestamp_t end;
+    end.counter = object->end_counter;
+    end.overflows = object->end_overflows;
+    end.timer_info = object->timer_info;
+
+    uint64_t deadline = software_timer_get_ticks(&end);
+    uint64_t now = software_timer_get_ticks(timestamp);
+
+    // An expired timer keeps 0 remaining ticks, the offset of one marks the pause
+    object->paused_ticks = ((deadline > now) ? (deadline - now) : 0) + 1;
+    object->end_overflows = UINT64_MAX;
+
+    return true;
+}
+
+bool software_timer_rescale (software_timer_t * object, const software_timer_timer_info_t * timer_info)
+{
+    if(software_timer_is_running(object))
+    {
+        return false;
+    }
+
+    const software_timer_timer_info_t * const old_timer_info = object->timer_info;
+    uint64_t period = old_timer_info->period;
+
+    if(object->duration_overflows > (UINT64_MAX - object->duration_counter) / period)
+    {
+        return false;
+    }
+
+    uint64_t duration = object->duration_overflows * period + object->duration_counter;
+    duration = software_timer_convert_ticks(duration, old_timer_info, timer_info);
+
+    uint64_t paused_ticks = object->paused_ticks;
+
+    if(software_timer_is_paused(object))
+    {
+        paused_ticks = software_timer_convert_ticks(paused_ticks - 1, old_timer_info, timer_info);
+    }
+
+    // A saturated conversion does not fit, it also leaves no room for the offset of a pause
+    if(UINT64_MAX == duration || UINT64_MAX == paused_ticks)
+    {
+        return false;
+    }
+
+    software_timer_timestamp_t timestamp;
+    timestamp.timer_info = timer_info;
+    software_timer_set_ticks(&timestamp, duration);
+
+    object->duration_overflows = timestamp.overflows;
+    object->duration_counter = timestamp.counter;
+
+    if(software_timer_is_paused(object))
+    {
+        object->paused_ticks = paused_ticks + 1;
+    }
+
+    object->timer_info = timer_info;
+
+    return true;
+}
+
+bool software_timer_restart (software_timer_t * object)
+{
+    if(software_timer_is_stopped(object))
+    {
+        return false;
+    }
+
+    software_timer_start_from(object, object->end_counter, object->end_overflows);
+
+    return true;
+}
+
+bool software_timer_resume (software_timer_t * object)
+{
+    if(!software_timer_is_paused(object))
+    {
+        return false;
+    }
+
+    software_timer_timestamp_t timestamp;
+    software_timer_get_timestamp(object, &timestamp);
+
+    return software_timer_resume_at(object, &timestamp);
+}
+
+bool software_timer_resume_at (software_timer_t * object, const software_timer_timestamp_t * timestamp)
+{
+    if(!software_timer_is_paused(object))
+    {
+        return false;
+    }
+
+    software_timer_timestamp_t end;
+    end.timer_info = object->timer_info;
+    software_timer_set_ticks(&end, software_timer_get_ticks(timestamp) + object->paused_ticks - 1);
+
+    object->paused_ticks = 0;
+    object->end_overflows = end.overflows;
+    object->end_counter = end.counter;
+
+    return true;
+}
+
+uint64_t software_timer_resync (software_timer_t * object, software_timer_resync_policy_t policy)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_get_timestamp(object, &timestamp);
+
+    return software_timer_resync_at(object, &timestamp, policy);
+}
+
+uint64_t software_timer_resync_at (software_timer_t * object, const software_timer_timestamp_t * timestamp, software_timer_resync_policy_t policy)
+{
+    if(software_timer_is_stopped(object))
+    {
+        return 0;
+    }
+
+    software_timer_timestamp_t end;
+    end.counter = object->end_counter;
+    end.overflows = object->end_overflows;
+    end.timer_info = object->timer_info;
+
+    uint64_t deadline = software_timer_get_ticks(&end);
+    uint64_t now = software_timer_get_ticks(timestamp);
+
+    if(deadline > now)
+    {
+        return 0;
+    }
+
+    uint64_t duration = object->duration_overflows * object->timer_info->period + object->duration_counter;
+
+    // Without a duration, the timer cannot be moved past the current time
+    if(0 == duration)
+    {
+        return 1;
+    }
+
+    uint64_t missed = (now - deadline) / duration + 1;
+
+    if(SOFTWARE_TIMER_RESYNC_POLICY_REPORT != policy)
+    {
+        // With `FIRE_ONCE` the deadline stays on the last missed expiry
+        uint64_t skipped = (SOFTWARE_TIMER_RESYNC_POLICY_FIRE_ONCE == policy) ? (missed - 1) : missed;
+
+        software_timer_set_ticks(&end, deadline + skipped * duration);
+
+        object->end_overflows = end.overflows;
+        object->end_counter = end.counter;
+    }
+
+    return missed;
+}
+
 void software_timer_set_duration (software_timer_t * object, const software_timer_duration_t * duration)
 {
     object->time_in_seconds = duration->time_in_seconds;
@@ -438,42 +989,89 @@ void software_timer_set_duration (software_timer_t * object, const software_time
     object->duration_overflows = duration->duration_overflows;
 }
 
+void software_timer_set_slack (software_timer_t * object, uint32_t slack)
+{
+    object->slack = slack;
+}
+
+void software_timer_set_ticks (software_timer_timestamp_t * timestamp, uint64_t ticks)
+{
+    const software_timer_timer_info_t * const timer_info = timestamp->timer_info;
+
+    if(timer_info->period_is_power_of_two)
+    {
+        timestamp->overflows = ticks >> timer_info->period_shift;
+        timestamp->counter = (uint16_t)(ticks & timer_info->period_mask);
+    }
+    else
+    {
+        uint64_t counter;
+        timestamp->overflows = software_timer_div(ticks, timer_info->period, timer_info->overflows_mult, timer_info->overflows_shift, &counter);
+        timestamp->counter = (uint16_t)counter;
+    }
+}
+
 void software_timer_start (software_timer_t *object)
 {
-    const software_timer_timer_info_t * const timer_info = object->timer_info;
-    volatile uint64_t * overflows_ptr = timer_info->overflows;
-    volatile uint16_t * counter_ptr = timer_info->counter;
+    uint16_t counter;
+    uint64_t overflows;
+    software_timer_read(object->timer_info, &counter, &overflows);
 
-    // The `overflows` and `counter` read operations are not thread/interrupt safe.
-    // By reading in twice, it is possible to check whether there was
-    // an overflow and, if so, to read in the correct value.
-    uint16_t counter_a = *counter_ptr;
-    uint64_t overflows = *overflows_ptr;
-    uint16_t counter = *counter_ptr;
-    if(counter < counter_a)
+    software_timer_start_from(object, counter, overflows);
+}
+
+void software_timer_start_aligned (software_timer_t * object, uint64_t period_boundary)
+{
+    if(0 == period_boundary)
     {
-        overflows = *overflows_ptr;
+        software_timer_start(object);
+        return;
     }
 
-    uint32_t end_counter = (uint32_t)counter + object->duration_counter;
-    overflows += object->duration_overflows;
+    software_timer_timestamp_t timestamp;
+    software_timer_get_timestamp(object, &timestamp);
 
-    uint32_t capture_compare = (uint32_t)timer_info->capture_compare + 1;
+    uint64_t ticks = software_timer_get_ticks(&timestamp);
+    software_timer_set_ticks(&timestamp, (ticks / period_boundary + 1) * period_boundary);
 
+    software_timer_start_at(object, &timestamp);
+}
 
-    if( capture_compare <= end_counter )
+void software_timer_start_at (software_timer_t * object, const software_timer_timestamp_t * timestamp)
+{
+    object->end_overflows = timestamp->overflows;
+    object->end_counter = timestamp->counter;
+    object->paused_ticks = 0;
+}
+
+void software_timer_start_batch (software_timer_t * timers, uint32_t count)
+{
+    if(0 == count)
     {
-        overflows += 1;
-        end_counter -= capture_compare;
+        return;
     }
 
-    object->end_overflows = overflows;
-    object->end_counter = (uint16_t)end_counter;
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(timers[0].timer_info, &timestamp);
+
+    software_timer_start_batch_at(timers, count, &timestamp);
+}
+
+void software_timer_start_batch_at (software_timer_t * timers, uint32_t count, const software_timer_timestamp_t * timestamp)
+{
+    uint16_t counter = timestamp->counter;
+    uint64_t overflows = timestamp->overflows;
+
+    for(uint32_t index = 0; index < count; ++index)
+    {
+        software_timer_start_from(&timers[index], counter, overflows);
+    }
 }
 
 void software_timer_stop (software_timer_t *object)
 {
     object->end_overflows = UINT64_MAX;
+    object->paused_ticks = 0;
 }
 
 void software_timer_sub_timestamp (software_timer_timestamp_t * result_and_minuend, const software_timer_timestamp_t * subtrahend)
@@ -493,6 +1091,88 @@ void software_timer_sub_timestamp (software_timer_timestamp_t * result_and_minue
     result_and_minuend->overflows = overflows;
 }
 
+void software_timer_timer_info_get_timestamp (const software_timer_timer_info_t * timer_info, software_timer_timestamp_t * timestamp)
+{
+    uint16_t counter;
+    uint64_t overflows;
+    software_timer_read(timer_info, &counter, &overflows);
+
+    timestamp->counter = counter;
+    timestamp->overflows = overflows;
+    timestamp->timer_info = timer_info;
+}
+
+software_timer_timer_info_flag_t software_timer_timer_info_init (software_timer_timer_info_t * timer_info)
+{
+    software_timer_timer_info_flag_t flags = SOFTWARE_TIMER_TIMER_INFO_FLAG_VALID;
+
+    if(NULL == timer_info->counter)
+    {
+        flags = (software_timer_timer_info_flag_t) (flags | SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_COUNTER);
+    }
+
+    if(NULL == timer_info->overflows)
+    {
+        flags = (software_timer_timer_info_flag_t) (flags | SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_OVERFLOWS);
+    }
+
+    // ---- ---- ---- ----
+
+    uint32_t period = (uint32_t)timer_info->capture_compare + 1;
+
+    timer_info->period = period;
+    timer_info->period_is_power_of_two = (0 == (period & (period - 1)));
+    timer_info->period_mask = timer_info->period_is_power_of_two ? (period - 1) : 0;
+    timer_info->period_shift = timer_info->period_is_power_of_two ? software_timer_log2(period) : 0;
+    timer_info->capture_compare_inverse = 1.0 / (double)period;
+
+    software_timer_reciprocal(period, &timer_info->overflows_mult, &timer_info->overflows_shift);
+
+    // ---- ---- ---- ----
+
+    uint64_t ticks_per_second = timer_info->ticks_per_second;
+
+    if(0 == ticks_per_second)
+    {
+        timer_info->seconds_per_tick = 0.0;
+        timer_info->seconds_mult = 0;
+        timer_info->seconds_shift = 0;
+        timer_info->nanoseconds_mult = 0;
+        timer_info->nanoseconds_shift = 0;
+
+        return (software_timer_timer_info_flag_t) (flags | SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_TICKS_PER_SECOND);
+    }
+
+    timer_info->seconds_per_tick = 1.0 / (double)ticks_per_second;
+
+    software_timer_reciprocal(ticks_per_second, &timer_info->seconds_mult, &timer_info->seconds_shift);
+
+    // With `2^nanoseconds_shift >= ticks_per_second` the estimate is at most one
+    // nanosecond too small, the multiplier is smaller than 2^31.
+
+    if(ticks_per_second <= UINT32_MAX)
+    {
+        uint8_t nanoseconds_shift = software_timer_log2(ticks_per_second);
+
+        if((UINT64_C(1) << nanoseconds_shift) < ticks_per_second)
+        {
+            ++nanoseconds_shift;
+        }
+
+        timer_info->nanoseconds_mult = (uint32_t)((SOFTWARE_TIMER_NS_PER_SECOND << nanoseconds_shift) / ticks_per_second);
+        timer_info->nanoseconds_shift = nanoseconds_shift;
+    }
+    else
+    {
+        timer_info->nanoseconds_mult = 0;
+        timer_info->nanoseconds_shift = 0;
+
+        flags = (software_timer_timer_info_flag_t) (flags | SOFTWARE_TIMER_TIMER_INFO_FLAG_SLOW_NS_CONVERSION);
+    }
+
+    return flags;
+}
+
 
 /*---------------------------------------------------------------------*
  *  eof
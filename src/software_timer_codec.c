@@ -0,0 +1,208 @@
+//! @file
+//! @brief The software_timer_codec source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_codec.h"
+#include "software_timer_varint.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_codec_sc software_timer_codec =
+{
+    software_timer_codec_init,
+    software_timer_codec_open,
+    software_timer_codec_read,
+    software_timer_codec_seek,
+    software_timer_codec_write,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static INLINE bool software_timer_codec_is_keyframe (const software_timer_codec_t * codec, uint64_t number);
+static size_t software_timer_codec_decode (const software_timer_codec_t * codec, size_t position, uint64_t number, uint64_t * ticks);
+static void software_timer_codec_add_keyframe (software_timer_codec_t * codec, size_t position);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Determines whether the timestamp with the number is stored absolute
+static INLINE bool software_timer_codec_is_keyframe (const software_timer_codec_t * codec, uint64_t number)
+{
+    return 0 == (number % codec->keyframe_interval);
+}
+
+//! @brief Decodes the timestamp with the number at the position, `ticks` is the previous timestamp on input
+static size_t software_timer_codec_decode (const software_timer_codec_t * codec, size_t position, uint64_t number, uint64_t * ticks)
+{
+    uint64_t value;
+    size_t length = software_timer_varint_read(&codec->buffer[position], codec->size - position, &value);
+
+    if(0 != length)
+    {
+        *ticks = software_timer_codec_is_keyframe(codec, number) ? value : *ticks + (uint64_t)software_timer_varint_zigzag_decode(value);
+    }
+
+    return length;
+}
+
+//! @brief Stores the position of a keyframe in the index if there is space
+static void software_timer_codec_add_keyframe (software_timer_codec_t * codec, size_t position)
+{
+    if(codec->keyframes_count < codec->keyframes_capacity)
+    {
+        codec->keyframes[codec->keyframes_count] = position;
+    }
+
+    ++codec->keyframes_count;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+void software_timer_codec_init (software_timer_codec_t * codec, const software_timer_timer_info_t * timer_info, uint8_t * buffer, size_t capacity, uint32_t keyframe_interval, size_t * keyframes, uint32_t keyframes_capacity)
+{
+    codec->timer_info = timer_info;
+    codec->buffer = buffer;
+    codec->capacity = capacity;
+    codec->size = 0;
+    codec->position = 0;
+    codec->keyframe_interval = (0 == keyframe_interval) ? 1 : keyframe_interval;
+    codec->keyframes = keyframes;
+    codec->keyframes_capacity = (NULL == keyframes) ? 0 : keyframes_capacity;
+    codec->keyframes_count = 0;
+    codec->count = 0;
+    codec->write_ticks = 0;
+    codec->read_count = 0;
+    codec->read_ticks = 0;
+}
+
+bool software_timer_codec_open (software_timer_codec_t * codec, size_t size)
+{
+    bool complete = (size <= codec->capacity);
+
+    codec->size = complete ? size : codec->capacity;
+    codec->keyframes_count = 0;
+    codec->count = 0;
+    codec->write_ticks = 0;
+
+    size_t position = 0;
+
+    while(position < codec->size)
+    {
+        if(software_timer_codec_is_keyframe(codec, codec->count))
+        {
+            software_timer_codec_add_keyframe(codec, position);
+        }
+
+        size_t length = software_timer_codec_decode(codec, position, codec->count, &codec->write_ticks);
+
+        if(0 == length)
+        {
+            // The incomplete timestamp is dropped, so that further timestamps can be appended
+            codec->keyframes_count -= software_timer_codec_is_keyframe(codec, codec->count) ? 1 : 0;
+            codec->size = position;
+            complete = false;
+            break;
+        }
+
+        position += length;
+        ++codec->count;
+    }
+
+    software_timer_codec_seek(codec, 0);
+
+    return complete;
+}
+
+bool software_timer_codec_read (software_timer_codec_t * codec, software_timer_timestamp_t * timestamp)
+{
+    if(codec->position >= codec->size)
+    {
+        return false;
+    }
+
+    size_t length = software_timer_codec_decode(codec, codec->position, codec->read_count, &codec->read_ticks);
+
+    if(0 == length)
+    {
+        return false;
+    }
+
+    codec->position += length;
+    ++codec->read_count;
+
+    timestamp->timer_info = codec->timer_info;
+    software_timer_set_ticks(timestamp, codec->read_ticks);
+
+    return true;
+}
+
+bool software_timer_codec_seek (software_timer_codec_t * codec, uint32_t keyframe)
+{
+    if(0 != keyframe && (keyframe >= codec->keyframes_count || keyframe >= codec->keyframes_capacity))
+    {
+        return false;
+    }
+
+    codec->position = (0 == keyframe) ? 0 : codec->keyframes[keyframe];
+    codec->read_count = (uint64_t)keyframe * codec->keyframe_interval;
+    codec->read_ticks = 0;
+
+    return true;
+}
+
+bool software_timer_codec_write (software_timer_codec_t * codec, const software_timer_timestamp_t * timestamp)
+{
+    uint64_t ticks = software_timer_get_ticks(timestamp);
+    bool keyframe = software_timer_codec_is_keyframe(codec, codec->count);
+
+    // The difference is signed, so that timestamps of several sources may be slightly out of order
+    uint64_t value = keyframe ? ticks : software_timer_varint_zigzag_encode((int64_t)(ticks - codec->write_ticks));
+
+    size_t length = software_timer_varint_write(&codec->buffer[codec->size], codec->capacity - codec->size, value);
+
+    if(0 == length)
+    {
+        return false;
+    }
+
+    if(keyframe)
+    {
+        software_timer_codec_add_keyframe(codec, codec->size);
+    }
+
+    codec->size += length;
+    codec->write_ticks = ticks;
+    ++codec->count;
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
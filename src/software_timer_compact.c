@@ -0,0 +1,190 @@
+//! @file
+//! @brief The software_timer_compact source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_compact.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+_Static_assert(16 == sizeof(software_timer_compact_t), "software_timer_compact_t must be 16 bytes");
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_compact_sc software_timer_compact =
+{
+    software_timer_compact_add,
+    software_timer_compact_calculate_period,
+    software_timer_compact_init,
+    software_timer_compact_is_running,
+    software_timer_compact_next_deadline,
+    software_timer_compact_poll,
+    software_timer_compact_remove,
+    software_timer_compact_start,
+    software_timer_compact_stop,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_compact_t * software_timer_compact_add (software_timer_compact_pool_t * pool, uint32_t handle, uint32_t period)
+{
+    if(pool->count >= pool->capacity)
+    {
+        return NULL;
+    }
+
+    software_timer_compact_t * timer = &pool->timers[pool->count++];
+
+    timer->deadline = SOFTWARE_TIMER_COMPACT_STOPPED;
+    timer->period = period;
+    timer->handle = handle;
+
+    return timer;
+}
+
+software_timer_duration_flag_t software_timer_compact_calculate_period (const software_timer_timer_info_t * timer_info, double time_in_seconds, uint32_t * period)
+{
+    software_timer_duration_t duration;
+    software_timer_duration_flag_t flags = software_timer_calculate_duration(timer_info, time_in_seconds, &duration);
+
+    // The overflows are limited first so that the multiplication cannot exceed 64 bits
+    if( (0 == (flags & SOFTWARE_TIMER_DURATION_FLAG_GREATER_MAX)) &&
+        (duration.duration_overflows <= (UINT32_MAX / timer_info->period)) )
+    {
+        uint64_t ticks = duration.duration_overflows * timer_info->period + duration.duration_counter;
+
+        if(ticks <= UINT32_MAX)
+        {
+            *period = (uint32_t)ticks;
+            return flags;
+        }
+    }
+
+    *period = UINT32_MAX;
+    return (software_timer_duration_flag_t) (flags | SOFTWARE_TIMER_DURATION_FLAG_GREATER_MAX);
+}
+
+void software_timer_compact_init (software_timer_compact_pool_t * pool, software_timer_compact_t * timers, uint32_t capacity, const software_timer_timer_info_t * timer_info, software_timer_compact_handler_t on_tick)
+{
+    pool->timers = timers;
+    pool->capacity = capacity;
+    pool->count = 0;
+    pool->timer_info = timer_info;
+    pool->on_tick = on_tick;
+    pool->user_data = NULL;
+}
+
+bool software_timer_compact_is_running (const software_timer_compact_t * timer)
+{
+    return SOFTWARE_TIMER_COMPACT_STOPPED != timer->deadline;
+}
+
+uint64_t software_timer_compact_next_deadline (const software_timer_compact_pool_t * pool)
+{
+    const software_timer_compact_t * timers = pool->timers;
+    uint32_t count = pool->count;
+
+    uint64_t next_deadline = SOFTWARE_TIMER_COMPACT_STOPPED;
+
+    for(uint32_t index = 0; index < count; ++index)
+    {
+        uint64_t deadline = timers[index].deadline;
+        next_deadline = (deadline < next_deadline) ? deadline : next_deadline;
+    }
+
+    return next_deadline;
+}
+
+uint32_t software_timer_compact_poll (software_timer_compact_pool_t * pool)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(pool->timer_info, &timestamp);
+
+    uint64_t now = software_timer_get_ticks(&timestamp);
+
+    software_timer_compact_t * timers = pool->timers;
+    software_timer_compact_handler_t on_tick = pool->on_tick;
+    uint32_t count = pool->count;
+    uint32_t expired = 0;
+
+    for(uint32_t index = 0; index < count; ++index)
+    {
+        software_timer_compact_t * timer = &timers[index];
+
+        // A stopped timer has the deadline `UINT64_MAX` and never expires
+        if(timer->deadline <= now && SOFTWARE_TIMER_COMPACT_STOPPED != timer->deadline)
+        {
+            timer->deadline += timer->period;
+            ++expired;
+
+            if(NULL != on_tick) { on_tick(pool, timer); }
+        }
+    }
+
+    return expired;
+}
+
+bool software_timer_compact_remove (software_timer_compact_pool_t * pool, software_timer_compact_t * timer)
+{
+    // The addresses are compared as integers, pointers into other objects cannot be compared in C
+    uintptr_t offset = (uintptr_t)timer - (uintptr_t)pool->timers;
+
+    if((uintptr_t)timer < (uintptr_t)pool->timers || 0 != offset % sizeof(software_timer_compact_t) || offset / sizeof(software_timer_compact_t) >= pool->count)
+    {
+        return false;
+    }
+
+    software_timer_compact_t * last = &pool->timers[--pool->count];
+
+    if(timer != last)
+    {
+        *timer = *last;
+    }
+
+    return true;
+}
+
+void software_timer_compact_start (software_timer_compact_pool_t * pool, software_timer_compact_t * timer)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(pool->timer_info, &timestamp);
+
+    timer->deadline = software_timer_get_ticks(&timestamp) + timer->period;
+}
+
+void software_timer_compact_stop (software_timer_compact_t * timer)
+{
+    timer->deadline = SOFTWARE_TIMER_COMPACT_STOPPED;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
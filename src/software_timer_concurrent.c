@@ -0,0 +1,236 @@
+//! @file
+//! @brief The software_timer_concurrent source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_concurrent.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+//! @brief Mask of the phase in ::software_timer_concurrent_slot_s::state
+#define SOFTWARE_TIMER_CONCURRENT_PHASE_MASK (UINT32_C(3))
+
+//! @brief Increment of the generation in ::software_timer_concurrent_slot_s::state
+#define SOFTWARE_TIMER_CONCURRENT_GENERATION_ONE (UINT32_C(4))
+
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_concurrent_sc software_timer_concurrent =
+{
+    software_timer_concurrent_add,
+    software_timer_concurrent_cancel,
+    software_timer_concurrent_init,
+    software_timer_concurrent_is_armed,
+    software_timer_concurrent_poll,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static INLINE bool software_timer_concurrent_matches (uint32_t state, software_timer_concurrent_handle_t handle);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Compares the generation of the state with the one of the handle
+static INLINE bool software_timer_concurrent_matches (uint32_t state, software_timer_concurrent_handle_t handle)
+{
+    return ((state >> 2) & SOFTWARE_TIMER_CONCURRENT_GENERATION_MASK) == (handle >> SOFTWARE_TIMER_CONCURRENT_INDEX_BITS);
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_concurrent_handle_t software_timer_concurrent_add (software_timer_concurrent_t * set, const software_timer_t * timer, bool periodic)
+{
+    uint32_t capacity = set->capacity;
+    uint32_t start = __atomic_load_n(&set->next, __ATOMIC_RELAXED);
+
+    for(uint32_t offset = 0; offset < capacity; ++offset)
+    {
+        uint32_t index = (start + offset) % capacity;
+        software_timer_concurrent_slot_t * slot = &set->slots[index];
+        uint32_t state = __atomic_load_n(&slot->state, __ATOMIC_RELAXED);
+
+        if(SOFTWARE_TIMER_CONCURRENT_PHASE_FREE != (state & SOFTWARE_TIMER_CONCURRENT_PHASE_MASK))
+        {
+            continue;
+        }
+
+        if(!__atomic_compare_exchange_n(&slot->state, &state, state | SOFTWARE_TIMER_CONCURRENT_PHASE_WRITING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            continue;
+        }
+
+        slot->timer = *timer;
+        slot->periodic = periodic;
+        __atomic_store_n(&slot->cancelled, 0, __ATOMIC_RELAXED);
+
+        // The timer is published together with the phase
+        __atomic_store_n(&slot->state, state | SOFTWARE_TIMER_CONCURRENT_PHASE_ARMED, __ATOMIC_RELEASE);
+        __atomic_store_n(&set->next, index + 1, __ATOMIC_RELAXED);
+
+        return (((state >> 2) & SOFTWARE_TIMER_CONCURRENT_GENERATION_MASK) << SOFTWARE_TIMER_CONCURRENT_INDEX_BITS) | index;
+    }
+
+    return SOFTWARE_TIMER_CONCURRENT_INVALID_HANDLE;
+}
+
+bool software_timer_concurrent_cancel (software_timer_concurrent_t * set, software_timer_concurrent_handle_t handle)
+{
+    uint32_t index = handle & SOFTWARE_TIMER_CONCURRENT_INDEX_MASK;
+
+    if(index >= set->capacity)
+    {
+        return false;
+    }
+
+    software_timer_concurrent_slot_t * slot = &set->slots[index];
+    bool requested = false;
+
+    for(;;)
+    {
+        uint32_t state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+
+        // After a request the poller has freed the slot, so the generation has changed
+        if(!software_timer_concurrent_matches(state, handle))
+        {
+            return requested;
+        }
+
+        switch(state & SOFTWARE_TIMER_CONCURRENT_PHASE_MASK)
+        {
+            case SOFTWARE_TIMER_CONCURRENT_PHASE_ARMED:
+            {
+                uint32_t freed = (state & ~SOFTWARE_TIMER_CONCURRENT_PHASE_MASK) + SOFTWARE_TIMER_CONCURRENT_GENERATION_ONE;
+
+                if(__atomic_compare_exchange_n(&slot->state, &state, freed, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+                {
+                    return true;
+                }
+
+                break;
+            }
+
+            case SOFTWARE_TIMER_CONCURRENT_PHASE_POLLING:
+            {
+                // The poller frees the slot after the handler instead of arming it again. The state
+                // includes the generation, so a late request does not hit a reused slot.
+                __atomic_store_n(&slot->cancelled, state, __ATOMIC_RELEASE);
+                requested = true;
+                break;
+            }
+
+            default:
+            {
+                return requested;
+            }
+        }
+    }
+}
+
+bool software_timer_concurrent_init (software_timer_concurrent_t * set, software_timer_concurrent_slot_t * slots, uint32_t capacity)
+{
+    if(capacity >= SOFTWARE_TIMER_CONCURRENT_INDEX_MASK)
+    {
+        return false;
+    }
+
+    for(uint32_t index = 0; index < capacity; ++index)
+    {
+        slots[index].state = SOFTWARE_TIMER_CONCURRENT_PHASE_FREE;
+        slots[index].cancelled = 0;
+        slots[index].periodic = false;
+    }
+
+    set->slots = slots;
+    set->capacity = capacity;
+    set->next = 0;
+
+    return true;
+}
+
+bool software_timer_concurrent_is_armed (const software_timer_concurrent_t * set, software_timer_concurrent_handle_t handle)
+{
+    uint32_t index = handle & SOFTWARE_TIMER_CONCURRENT_INDEX_MASK;
+
+    if(index >= set->capacity)
+    {
+        return false;
+    }
+
+    uint32_t state = __atomic_load_n(&set->slots[index].state, __ATOMIC_ACQUIRE);
+
+    return software_timer_concurrent_matches(state, handle) &&
+           (SOFTWARE_TIMER_CONCURRENT_PHASE_ARMED <= (state & SOFTWARE_TIMER_CONCURRENT_PHASE_MASK));
+}
+
+uint32_t software_timer_concurrent_poll (software_timer_concurrent_t * set)
+{
+    uint32_t expired = 0;
+
+    for(uint32_t index = 0; index < set->capacity; ++index)
+    {
+        software_timer_concurrent_slot_t * slot = &set->slots[index];
+        uint32_t state = __atomic_load_n(&slot->state, __ATOMIC_RELAXED);
+
+        if(SOFTWARE_TIMER_CONCURRENT_PHASE_ARMED != (state & SOFTWARE_TIMER_CONCURRENT_PHASE_MASK))
+        {
+            continue;
+        }
+
+        // The slot is owned by this poller until the phase is changed again
+        if(!__atomic_compare_exchange_n(&slot->state, &state, state | SOFTWARE_TIMER_CONCURRENT_PHASE_POLLING, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            continue;
+        }
+
+        uint32_t generation = state & ~SOFTWARE_TIMER_CONCURRENT_PHASE_MASK;
+        uint32_t polling = generation | SOFTWARE_TIMER_CONCURRENT_PHASE_POLLING;
+        bool fired = false;
+
+        if(polling != __atomic_load_n(&slot->cancelled, __ATOMIC_ACQUIRE))
+        {
+            fired = software_timer_elapsed(&slot->timer);
+            expired += fired ? 1 : 0;
+        }
+
+        if(polling == __atomic_load_n(&slot->cancelled, __ATOMIC_ACQUIRE) || (fired && !slot->periodic))
+        {
+            __atomic_store_n(&slot->state, generation + SOFTWARE_TIMER_CONCURRENT_GENERATION_ONE, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            __atomic_store_n(&slot->state, generation | SOFTWARE_TIMER_CONCURRENT_PHASE_ARMED, __ATOMIC_RELEASE);
+        }
+    }
+
+    return expired;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,116 @@
+//! @file
+//! @brief The software_timer_divider source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_divider.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_divider_sc software_timer_divider =
+{
+    software_timer_divider_add,
+    software_timer_divider_init,
+    software_timer_divider_poll,
+    software_timer_divider_reset,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_divider_t * software_timer_divider_add (software_timer_divider_tree_t * tree, const software_timer_divider_t * parent, uint32_t divider, software_timer_divider_handler_t on_tick)
+{
+    if(tree->count >= tree->capacity || 0 == divider)
+    {
+        return NULL;
+    }
+
+    software_timer_divider_t * object = &tree->dividers[tree->count++];
+
+    object->parent = parent;
+    object->divider = divider;
+    object->remaining = divider;
+    object->fired = false;
+    object->on_tick = on_tick;
+    object->user_data = NULL;
+
+    return object;
+}
+
+void software_timer_divider_init (software_timer_divider_tree_t * tree, software_timer_t * base, software_timer_divider_t * dividers, uint32_t capacity)
+{
+    tree->base = base;
+    tree->dividers = dividers;
+    tree->capacity = capacity;
+    tree->count = 0;
+}
+
+uint32_t software_timer_divider_poll (software_timer_divider_tree_t * tree)
+{
+    if(!software_timer_elapsed(tree->base))
+    {
+        return 0;
+    }
+
+    software_timer_divider_t * dividers = tree->dividers;
+    uint32_t count = tree->count;
+    uint32_t expired = 0;
+
+    for(uint32_t index = 0; index < count; ++index)
+    {
+        software_timer_divider_t * object = &dividers[index];
+
+        // The parent is stored before the child, so its state is already up to date
+        bool parent_fired = (NULL == object->parent) || object->parent->fired;
+
+        object->fired = parent_fired && (0 == --object->remaining);
+
+        if(object->fired)
+        {
+            object->remaining = object->divider;
+            ++expired;
+
+            if(NULL != object->on_tick) { object->on_tick(object); }
+        }
+    }
+
+    return expired;
+}
+
+void software_timer_divider_reset (software_timer_divider_tree_t * tree)
+{
+    for(uint32_t index = 0; index < tree->count; ++index)
+    {
+        tree->dividers[index].remaining = tree->dividers[index].divider;
+        tree->dividers[index].fired = false;
+    }
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
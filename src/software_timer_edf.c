@@ -0,0 +1,224 @@
+//! @file
+//! @brief The software_timer_edf source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_edf.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_edf_sc software_timer_edf =
+{
+    software_timer_edf_dispatch,
+    software_timer_edf_init,
+    software_timer_edf_job_init,
+    software_timer_edf_next,
+    software_timer_edf_pop,
+    software_timer_edf_push,
+    software_timer_edf_remove,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static INLINE void software_timer_edf_set (software_timer_edf_t * queue, uint32_t index, software_timer_edf_job_t * job);
+static void software_timer_edf_sift_up (software_timer_edf_t * queue, uint32_t index);
+static void software_timer_edf_sift_down (software_timer_edf_t * queue, uint32_t index);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Stores the job at the position of the heap
+static INLINE void software_timer_edf_set (software_timer_edf_t * queue, uint32_t index, software_timer_edf_job_t * job)
+{
+    queue->heap[index] = job;
+    job->heap_index = index;
+}
+
+//! @brief Moves the job at the position towards the root until the parent is not later
+static void software_timer_edf_sift_up (software_timer_edf_t * queue, uint32_t index)
+{
+    software_timer_edf_job_t * job = queue->heap[index];
+
+    while(index > 0)
+    {
+        uint32_t parent = (index - 1) / 2;
+
+        if(queue->heap[parent]->deadline <= job->deadline)
+        {
+            break;
+        }
+
+        software_timer_edf_set(queue, index, queue->heap[parent]);
+        index = parent;
+    }
+
+    software_timer_edf_set(queue, index, job);
+}
+
+//! @brief Moves the job at the position towards the leaves until no child is earlier
+static void software_timer_edf_sift_down (software_timer_edf_t * queue, uint32_t index)
+{
+    software_timer_edf_job_t * job = queue->heap[index];
+    uint32_t count = queue->count;
+
+    for(;;)
+    {
+        uint32_t child = 2 * index + 1;
+
+        if(child >= count)
+        {
+            break;
+        }
+
+        if(child + 1 < count && queue->heap[child + 1]->deadline < queue->heap[child]->deadline)
+        {
+            ++child;
+        }
+
+        if(job->deadline <= queue->heap[child]->deadline)
+        {
+            break;
+        }
+
+        software_timer_edf_set(queue, index, queue->heap[child]);
+        index = child;
+    }
+
+    software_timer_edf_set(queue, index, job);
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_edf_job_t * software_timer_edf_dispatch (software_timer_edf_t * queue)
+{
+    software_timer_edf_job_t * job = software_timer_edf_pop(queue);
+
+    if(NULL == job)
+    {
+        return NULL;
+    }
+
+    job->function(job);
+
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(queue->timer_info, &timestamp);
+
+    job->missed = software_timer_get_ticks(&timestamp) > job->deadline;
+    ++queue->runs;
+
+    if(job->missed)
+    {
+        ++queue->misses;
+
+        if(NULL != queue->on_miss) { queue->on_miss(job); }
+    }
+
+    return job;
+}
+
+void software_timer_edf_init (software_timer_edf_t * queue, software_timer_edf_job_t ** heap, uint32_t capacity, const software_timer_timer_info_t * timer_info, software_timer_edf_function_t on_miss)
+{
+    queue->heap = heap;
+    queue->capacity = capacity;
+    queue->count = 0;
+    queue->timer_info = timer_info;
+    queue->on_miss = on_miss;
+    queue->runs = 0;
+    queue->misses = 0;
+}
+
+void software_timer_edf_job_init (software_timer_edf_job_t * job, const software_timer_timer_info_t * timer_info, software_timer_edf_function_t function)
+{
+    software_timer_init_halt(&job->timer, timer_info);
+
+    job->function = function;
+    job->user_data = NULL;
+    job->deadline = UINT64_MAX;
+    job->heap_index = SOFTWARE_TIMER_EDF_NOT_QUEUED;
+    job->missed = false;
+}
+
+software_timer_edf_job_t * software_timer_edf_next (const software_timer_edf_t * queue)
+{
+    return (0 == queue->count) ? NULL : queue->heap[0];
+}
+
+software_timer_edf_job_t * software_timer_edf_pop (software_timer_edf_t * queue)
+{
+    software_timer_edf_job_t * job = software_timer_edf_next(queue);
+
+    if(NULL != job)
+    {
+        software_timer_edf_remove(queue, job);
+    }
+
+    return job;
+}
+
+bool software_timer_edf_push (software_timer_edf_t * queue, software_timer_edf_job_t * job)
+{
+    if(queue->count >= queue->capacity || SOFTWARE_TIMER_EDF_NOT_QUEUED != job->heap_index)
+    {
+        return false;
+    }
+
+    job->deadline = software_timer_get_deadline_ticks(&job->timer);
+
+    software_timer_edf_set(queue, queue->count++, job);
+    software_timer_edf_sift_up(queue, job->heap_index);
+
+    return true;
+}
+
+bool software_timer_edf_remove (software_timer_edf_t * queue, software_timer_edf_job_t * job)
+{
+    uint32_t index = job->heap_index;
+
+    if(index >= queue->count || queue->heap[index] != job)
+    {
+        return false;
+    }
+
+    job->heap_index = SOFTWARE_TIMER_EDF_NOT_QUEUED;
+
+    software_timer_edf_job_t * last = queue->heap[--queue->count];
+
+    // The last job fills the gap and is moved up or down
+    if(last != job)
+    {
+        software_timer_edf_set(queue, index, last);
+        software_timer_edf_sift_up(queue, index);
+        software_timer_edf_sift_down(queue, last->heap_index);
+    }
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,189 @@
+//! @file
+//! @brief The software_timer_group source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_group.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_group_sc software_timer_group =
+{
+    software_timer_group_add,
+    software_timer_group_init,
+    software_timer_group_next_deadline,
+    software_timer_group_poll,
+    software_timer_group_remove,
+    software_timer_group_start,
+    software_timer_group_update,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static INLINE uint8_t software_timer_group_ctz (uint64_t value);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Returns the number of trailing zero bits, the value must not be 0
+static INLINE uint8_t software_timer_group_ctz (uint64_t value)
+{
+#if defined(__GNUC__)
+
+    return (uint8_t)__builtin_ctzll(value);
+
+#else
+
+    uint8_t count = 0;
+
+    while(0 == (value & 1))
+    {
+        value >>= 1;
+        ++count;
+    }
+
+    return count;
+
+#endif
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+uint8_t software_timer_group_add (software_timer_group_t * group, software_timer_t * timer)
+{
+    uint64_t free = ~group->used;
+
+    if(0 == free)
+    {
+        return SOFTWARE_TIMER_GROUP_INVALID_INDEX;
+    }
+
+    uint8_t index = software_timer_group_ctz(free);
+
+    group->members[index] = timer;
+    group->used |= UINT64_C(1) << index;
+
+    uint64_t deadline = software_timer_get_deadline_ticks(timer);
+    group->earliest = (deadline < group->earliest) ? deadline : group->earliest;
+
+    return index;
+}
+
+void software_timer_group_init (software_timer_group_t * group, const software_timer_timer_info_t * timer_info)
+{
+    for(uint8_t index = 0; index < SOFTWARE_TIMER_GROUP_MEMBERS; ++index)
+    {
+        group->members[index] = NULL;
+    }
+
+    group->used = 0;
+    group->earliest = UINT64_MAX;
+    group->timer_info = timer_info;
+}
+
+uint64_t software_timer_group_next_deadline (const software_timer_group_t * group)
+{
+    return group->earliest;
+}
+
+uint64_t software_timer_group_poll (software_timer_group_t * group)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(group->timer_info, &timestamp);
+
+    uint64_t now = software_timer_get_ticks(&timestamp);
+
+    // Nothing is due, this is the common case
+    if(now < group->earliest)
+    {
+        return 0;
+    }
+
+    uint64_t expired = 0;
+    uint64_t earliest = UINT64_MAX;
+    uint64_t used = group->used;
+
+    while(0 != used)
+    {
+        uint8_t index = software_timer_group_ctz(used);
+        used &= used - 1;
+
+        software_timer_t * timer = group->members[index];
+        uint64_t deadline = software_timer_get_deadline_ticks(timer);
+
+        if(deadline <= now)
+        {
+            software_timer_restart(timer);
+            expired |= UINT64_C(1) << index;
+
+            deadline = software_timer_get_deadline_ticks(timer);
+        }
+
+        earliest = (deadline < earliest) ? deadline : earliest;
+    }
+
+    group->earliest = earliest;
+
+    return expired;
+}
+
+void software_timer_group_remove (software_timer_group_t * group, uint8_t index)
+{
+    group->members[index] = NULL;
+    group->used &= ~(UINT64_C(1) << index);
+}
+
+void software_timer_group_start (software_timer_group_t * group, uint8_t index)
+{
+    software_timer_t * timer = group->members[index];
+    software_timer_start(timer);
+
+    uint64_t deadline = software_timer_get_deadline_ticks(timer);
+    group->earliest = (deadline < group->earliest) ? deadline : group->earliest;
+}
+
+void software_timer_group_update (software_timer_group_t * group)
+{
+    uint64_t earliest = UINT64_MAX;
+    uint64_t used = group->used;
+
+    while(0 != used)
+    {
+        uint8_t index = software_timer_group_ctz(used);
+        used &= used - 1;
+
+        uint64_t deadline = software_timer_get_deadline_ticks(group->members[index]);
+        earliest = (deadline < earliest) ? deadline : earliest;
+    }
+
+    group->earliest = earliest;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,219 @@
+//! @file
+//! @brief The software_timer_histogram source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <math.h>
+
+#include "software_timer_histogram.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+//! @brief Number of exactly counted values
+#define SOFTWARE_TIMER_HISTOGRAM_SUB_COUNT (UINT64_C(1) << SOFTWARE_TIMER_HISTOGRAM_SUB_BITS)
+
+//! @brief Number of buckets per power of two above the exactly counted values
+#define SOFTWARE_TIMER_HISTOGRAM_HALF_COUNT (UINT64_C(1) << (SOFTWARE_TIMER_HISTOGRAM_SUB_BITS - 1))
+
+#if (SOFTWARE_TIMER_HISTOGRAM_SUB_BITS < 2) || (SOFTWARE_TIMER_HISTOGRAM_MAX_BITS <= SOFTWARE_TIMER_HISTOGRAM_SUB_BITS) || (SOFTWARE_TIMER_HISTOGRAM_MAX_BITS > 63)
+#error "SOFTWARE_TIMER_HISTOGRAM_SUB_BITS or SOFTWARE_TIMER_HISTOGRAM_MAX_BITS out of range"
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_histogram_sc software_timer_histogram =
+{
+    software_timer_histogram_init,
+    software_timer_histogram_merge,
+    software_timer_histogram_percentile,
+    software_timer_histogram_record,
+    software_timer_histogram_record_interval,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static INLINE uint32_t software_timer_histogram_index (uint64_t ticks);
+static uint64_t software_timer_histogram_highest (uint32_t index);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Determines the bucket of the value, the value must be smaller than `2^SOFTWARE_TIMER_HISTOGRAM_MAX_BITS`
+static INLINE uint32_t software_timer_histogram_index (uint64_t ticks)
+{
+    if(ticks < SOFTWARE_TIMER_HISTOGRAM_SUB_COUNT)
+    {
+        return (uint32_t)ticks;
+    }
+
+#if defined(__GNUC__)
+
+    uint32_t msb = 63 - (uint32_t)__builtin_clzll(ticks);
+
+#else
+
+    uint32_t msb = SOFTWARE_TIMER_HISTOGRAM_SUB_BITS;
+
+    while(0 != (ticks >> (msb + 1)))
+    {
+        ++msb;
+    }
+
+#endif
+
+    // The highest SUB_BITS bits of the value select the bucket within its power of two
+    uint32_t shift = msb - (SOFTWARE_TIMER_HISTOGRAM_SUB_BITS - 1);
+
+    return (uint32_t)(SOFTWARE_TIMER_HISTOGRAM_SUB_COUNT + (shift - 1) * SOFTWARE_TIMER_HISTOGRAM_HALF_COUNT
+                      + ((ticks >> shift) - SOFTWARE_TIMER_HISTOGRAM_HALF_COUNT));
+}
+
+//! @brief Determines the largest value of the bucket
+static uint64_t software_timer_histogram_highest (uint32_t index)
+{
+    if(index < SOFTWARE_TIMER_HISTOGRAM_SUB_COUNT)
+    {
+        return index;
+    }
+
+    uint64_t offset = index - SOFTWARE_TIMER_HISTOGRAM_SUB_COUNT;
+    uint32_t shift = (uint32_t)(offset / SOFTWARE_TIMER_HISTOGRAM_HALF_COUNT) + 1;
+    uint64_t sub = offset % SOFTWARE_TIMER_HISTOGRAM_HALF_COUNT + SOFTWARE_TIMER_HISTOGRAM_HALF_COUNT;
+
+    return ((sub + 1) << shift) - 1;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+void software_timer_histogram_init (software_timer_histogram_t * histogram)
+{
+    for(uint32_t index = 0; index < SOFTWARE_TIMER_HISTOGRAM_BUCKETS; ++index)
+    {
+        histogram->counts[index] = 0;
+    }
+
+    histogram->count = 0;
+    histogram->saturated = 0;
+    histogram->min = UINT64_MAX;
+    histogram->max = 0;
+}
+
+void software_timer_histogram_merge (software_timer_histogram_t * destination, const software_timer_histogram_t * source)
+{
+#if defined(__GNUC__)
+
+    for(uint32_t index = 0; index < SOFTWARE_TIMER_HISTOGRAM_BUCKETS; ++index)
+    {
+        if(0 != source->counts[index])
+        {
+            __atomic_fetch_add(&destination->counts[index], source->counts[index], __ATOMIC_RELAXED);
+        }
+    }
+
+    __atomic_fetch_add(&destination->saturated, source->saturated, __ATOMIC_RELAXED);
+
+    uint64_t min = __atomic_load_n(&destination->min, __ATOMIC_RELAXED);
+    while(source->min < min && !__atomic_compare_exchange_n(&destination->min, &min, source->min, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+
+    uint64_t max = __atomic_load_n(&destination->max, __ATOMIC_RELAXED);
+    while(source->max > max && !__atomic_compare_exchange_n(&destination->max, &max, source->max, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+
+    // The total is published last, so that a reader never sees more values than are in the buckets
+    __atomic_fetch_add(&destination->count, source->count, __ATOMIC_RELEASE);
+
+#else
+
+    for(uint32_t index = 0; index < SOFTWARE_TIMER_HISTOGRAM_BUCKETS; ++index)
+    {
+        destination->counts[index] += source->counts[index];
+    }
+
+    destination->saturated += source->saturated;
+    destination->min = (source->min < destination->min) ? source->min : destination->min;
+    destination->max = (source->max > destination->max) ? source->max : destination->max;
+    destination->count += source->count;
+
+#endif
+}
+
+uint64_t software_timer_histogram_percentile (const software_timer_histogram_t * histogram, double percentile)
+{
+    if(0 == histogram->count)
+    {
+        return 0;
+    }
+
+    percentile = (percentile < 0) ? 0 : ((percentile > 100) ? 100 : percentile);
+
+    uint64_t target = (uint64_t)ceil(percentile / 100.0 * (double)histogram->count);
+    target = (0 == target) ? 1 : target;
+
+    uint64_t cumulative = 0;
+
+    for(uint32_t index = 0; index < SOFTWARE_TIMER_HISTOGRAM_BUCKETS; ++index)
+    {
+        cumulative += histogram->counts[index];
+
+        if(cumulative >= target)
+        {
+            uint64_t highest = software_timer_histogram_highest(index);
+            return (highest < histogram->max) ? highest : histogram->max;
+        }
+    }
+
+    return histogram->max;
+}
+
+void software_timer_histogram_record (software_timer_histogram_t * histogram, uint64_t ticks)
+{
+    uint32_t index;
+
+    if(ticks >> SOFTWARE_TIMER_HISTOGRAM_MAX_BITS)
+    {
+        index = SOFTWARE_TIMER_HISTOGRAM_BUCKETS - 1;
+        ++histogram->saturated;
+    }
+    else
+    {
+        index = software_timer_histogram_index(ticks);
+    }
+
+    ++histogram->counts[index];
+    ++histogram->count;
+    histogram->min = (ticks < histogram->min) ? ticks : histogram->min;
+    histogram->max = (ticks > histogram->max) ? ticks : histogram->max;
+}
+
+void software_timer_histogram_record_interval (software_timer_histogram_t * histogram, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end)
+{
+    software_timer_histogram_record(histogram, software_timer_get_ticks(end) - software_timer_get_ticks(start));
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,108 @@
+//! @file
+//! @brief The software_timer_host source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "software_timer_host.h"
+
+#if defined(__linux__)
+
+#include <time.h>
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+//! @brief Nanoseconds per second
+#define SOFTWARE_TIMER_HOST_NS_PER_SECOND (UINT64_C(1000000000))
+
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_host_sc software_timer_host =
+{
+    software_timer_host_init,
+    software_timer_host_monotonic_ns,
+    software_timer_host_ns_to_ticks,
+    software_timer_host_update,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_timer_info_flag_t software_timer_host_init (software_timer_host_t * host, software_timer_timer_info_t * timer_info)
+{
+    host->counter = 0;
+    host->overflows = 0;
+    host->timer_info = timer_info;
+
+    timer_info->counter = &host->counter;
+    timer_info->overflows = &host->overflows;
+
+    software_timer_timer_info_flag_t flags = software_timer_timer_info_init(timer_info);
+
+    host->epoch_ns = software_timer_host_monotonic_ns();
+
+    return flags;
+}
+
+uint64_t software_timer_host_monotonic_ns (void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * SOFTWARE_TIMER_HOST_NS_PER_SECOND + (uint64_t)now.tv_nsec;
+}
+
+uint64_t software_timer_host_ns_to_ticks (uint64_t ns, uint64_t ticks_per_second)
+{
+    return (ns / SOFTWARE_TIMER_HOST_NS_PER_SECOND) * ticks_per_second +
+           (ns % SOFTWARE_TIMER_HOST_NS_PER_SECOND) * ticks_per_second / SOFTWARE_TIMER_HOST_NS_PER_SECOND;
+}
+
+uint64_t software_timer_host_update (software_timer_host_t * host)
+{
+    uint64_t ticks = software_timer_host_ns_to_ticks(software_timer_host_monotonic_ns() - host->epoch_ns, host->timer_info->ticks_per_second);
+
+    software_timer_timestamp_t timestamp;
+    timestamp.timer_info = host->timer_info;
+    software_timer_set_ticks(&timestamp, ticks);
+
+    host->counter = timestamp.counter;
+    host->overflows = timestamp.overflows;
+
+    return ticks;
+}
+
+
+#endif /* defined(__linux__) */
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,288 @@
+//! @file
+//! @brief The software_timer_pool source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_pool.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+//! @brief End of the free list
+#define SOFTWARE_TIMER_POOL_END (SOFTWARE_TIMER_POOL_INDEX_MASK)
+
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_pool_sc software_timer_pool =
+{
+    software_timer_pool_alloc,
+    software_timer_pool_free,
+    software_timer_pool_get,
+    software_timer_pool_init,
+    software_timer_pool_is_allocated,
+    software_timer_pool_is_valid,
+    software_timer_pool_next_deadline,
+    software_timer_pool_pause,
+    software_timer_pool_poll,
+    software_timer_pool_rescale,
+    software_timer_pool_resume,
+    software_timer_pool_resync,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_handle_t software_timer_pool_alloc (software_timer_pool_t * pool)
+{
+    uint32_t index = pool->free_head;
+
+    if(SOFTWARE_TIMER_POOL_END == index)
+    {
+        return SOFTWARE_TIMER_POOL_INVALID_HANDLE;
+    }
+
+    software_timer_t * timer = &pool->timers[index];
+
+    pool->free_head = (uint32_t)timer->duration_overflows;
+    ++pool->count;
+
+    uint16_t generation = ++pool->generations[index];
+
+    software_timer_init_halt(timer, pool->timer_info);
+
+    return ((generation & SOFTWARE_TIMER_POOL_GENERATION_MASK) << SOFTWARE_TIMER_POOL_INDEX_BITS) | index;
+}
+
+bool software_timer_pool_free (software_timer_pool_t * pool, software_timer_handle_t handle)
+{
+    software_timer_t * timer = software_timer_pool_get(pool, handle);
+
+    if(NULL == timer)
+    {
+        return false;
+    }
+
+    uint32_t index = handle & SOFTWARE_TIMER_POOL_INDEX_MASK;
+
+    software_timer_stop(timer);
+    timer->duration_overflows = pool->free_head;
+
+    pool->free_head = index;
+    --pool->count;
+    ++pool->generations[index];
+
+    return true;
+}
+
+software_timer_t * software_timer_pool_get (const software_timer_pool_t * pool, software_timer_handle_t handle)
+{
+    uint32_t index = handle & SOFTWARE_TIMER_POOL_INDEX_MASK;
+
+    if(index >= pool->capacity)
+    {
+        return NULL;
+    }
+
+    uint32_t generation = pool->generations[index];
+
+    // The generation is odd if allocated and must match the masked generation of the handle
+    if( (0 == (generation & 1)) ||
+        ((generation & SOFTWARE_TIMER_POOL_GENERATION_MASK) != (handle >> SOFTWARE_TIMER_POOL_INDEX_BITS)) )
+    {
+        return NULL;
+    }
+
+    return &pool->timers[index];
+}
+
+bool software_timer_pool_init (software_timer_pool_t * pool, software_timer_t * timers, uint16_t * generations, uint32_t capacity, const software_timer_timer_info_t * timer_info)
+{
+    if(capacity >= SOFTWARE_TIMER_POOL_INDEX_MASK)
+    {
+        return false;
+    }
+
+    pool->timers = timers;
+    pool->generations = generations;
+    pool->capacity = capacity;
+    pool->count = 0;
+    pool->free_head = (0 == capacity) ? SOFTWARE_TIMER_POOL_END : 0;
+    pool->timer_info = timer_info;
+
+    for(uint32_t index = 0; index < capacity; ++index)
+    {
+        // A previously allocated timer gets the next (even) generation,
+        // so that handles of a previous use stay invalid
+        generations[index] = (uint16_t)(generations[index] + (generations[index] & 1));
+
+        software_timer_init_halt(&timers[index], timer_info);
+        timers[index].duration_overflows = (index + 1 < capacity) ? (index + 1) : SOFTWARE_TIMER_POOL_END;
+    }
+
+    return true;
+}
+
+bool software_timer_pool_is_allocated (const software_timer_pool_t * pool, uint32_t index)
+{
+    return 0 != (pool->generations[index] & 1);
+}
+
+bool software_timer_pool_is_valid (const software_timer_pool_t * pool, software_timer_handle_t handle)
+{
+    return NULL != software_timer_pool_get(pool, handle);
+}
+
+uint64_t software_timer_pool_next_deadline (const software_timer_pool_t * pool)
+{
+    uint64_t next_deadline = UINT64_MAX;
+
+    for(uint32_t index = 0; index < pool->capacity; ++index)
+    {
+        if(software_timer_pool_is_allocated(pool, index))
+        {
+            uint64_t deadline = software_timer_get_deadline_ticks(&pool->timers[index]);
+            next_deadline = (deadline < next_deadline) ? deadline : next_deadline;
+        }
+    }
+
+    return next_deadline;
+}
+
+uint32_t software_timer_pool_pause (software_timer_pool_t * pool)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(pool->timer_info, &timestamp);
+
+    uint32_t paused = 0;
+
+    for(uint32_t index = 0; index < pool->capacity; ++index)
+    {
+        if(software_timer_pool_is_allocated(pool, index) && software_timer_pause_at(&pool->timers[index], &timestamp))
+        {
+            ++paused;
+        }
+    }
+
+    return paused;
+}
+
+uint32_t software_timer_pool_poll (software_timer_pool_t * pool)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(pool->timer_info, &timestamp);
+
+    uint64_t now = software_timer_get_ticks(&timestamp);
+    uint32_t expired = 0;
+
+    for(uint32_t index = 0; index < pool->capacity; ++index)
+    {
+        if(software_timer_pool_is_allocated(pool, index))
+        {
+            software_timer_t * timer = &pool->timers[index];
+
+            // The timers are compared to the same instant, also those within their tolerance window
+            if(software_timer_get_end_ticks(timer) <= now && software_timer_expire(timer))
+            {
+                ++expired;
+            }
+        }
+    }
+
+    return expired;
+}
+
+uint32_t software_timer_pool_rescale (software_timer_pool_t * pool, const software_timer_timer_info_t * new_timer_info)
+{
+    // All timers of the pool are converted from the hardware timer of the pool
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(pool->timer_info, &timestamp);
+
+    uint32_t paused = 0;
+
+    for(uint32_t index = 0; index < pool->capacity; ++index)
+    {
+        if(software_timer_pool_is_allocated(pool, index))
+        {
+            software_timer_t * timer = &pool->timers[index];
+
+            software_timer_pause_at(timer, &timestamp);
+
+            // A time that does not fit into the new tick frequency can not be continued
+            if(!software_timer_rescale(timer, new_timer_info))
+            {
+                software_timer_stop(timer);
+                continue;
+            }
+
+            paused += software_timer_is_paused(timer) ? 1 : 0;
+        }
+    }
+
+    pool->timer_info = new_timer_info;
+
+    return paused;
+}
+
+uint32_t software_timer_pool_resume (software_timer_pool_t * pool)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(pool->timer_info, &timestamp);
+
+    uint32_t resumed = 0;
+
+    for(uint32_t index = 0; index < pool->capacity; ++index)
+    {
+        if(software_timer_pool_is_allocated(pool, index) && software_timer_resume_at(&pool->timers[index], &timestamp))
+        {
+            ++resumed;
+        }
+    }
+
+    return resumed;
+}
+
+uint64_t software_timer_pool_resync (software_timer_pool_t * pool, software_timer_resync_policy_t policy)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(pool->timer_info, &timestamp);
+
+    uint64_t missed = 0;
+
+    for(uint32_t index = 0; index < pool->capacity; ++index)
+    {
+        if(software_timer_pool_is_allocated(pool, index))
+        {
+            missed += software_timer_resync_at(&pool->timers[index], &timestamp, policy);
+        }
+    }
+
+    return missed;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,165 @@
+//! @file
+//! @brief The software_timer_recorder source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_recorder.h"
+#include "software_timer_varint.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_recorder_sc software_timer_recorder =
+{
+    software_timer_recorder_init_record,
+    software_timer_recorder_init_replay,
+    software_timer_recorder_rewind,
+    software_timer_recorder_sample,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static void software_timer_recorder_set_ticks (software_timer_recorder_t * recorder, uint64_t ticks);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Provides the ticks to the library
+static void software_timer_recorder_set_ticks (software_timer_recorder_t * recorder, uint64_t ticks)
+{
+    software_timer_timestamp_t timestamp;
+    timestamp.timer_info = recorder->timer_info;
+    software_timer_set_ticks(&timestamp, ticks);
+
+    recorder->overflows = timestamp.overflows;
+    recorder->counter = timestamp.counter;
+    recorder->ticks = ticks;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_timer_info_flag_t software_timer_recorder_init_record (software_timer_recorder_t * recorder, software_timer_timer_info_t * timer_info, const software_timer_timer_info_t * source, uint8_t * buffer, size_t capacity)
+{
+    *timer_info = *source;
+
+    recorder->source = source;
+    recorder->buffer = buffer;
+    recorder->capacity = capacity;
+
+    timer_info->counter = &recorder->counter;
+    timer_info->overflows = &recorder->overflows;
+    recorder->timer_info = timer_info;
+
+    software_timer_timer_info_flag_t flags = software_timer_timer_info_init(timer_info);
+
+    software_timer_recorder_rewind(recorder);
+
+    return flags;
+}
+
+software_timer_timer_info_flag_t software_timer_recorder_init_replay (software_timer_recorder_t * recorder, software_timer_timer_info_t * timer_info, const uint8_t * buffer, size_t size)
+{
+    recorder->source = NULL;
+
+    // The stream is only read in replay mode
+    recorder->buffer = (uint8_t *)buffer;
+    recorder->capacity = size;
+
+    timer_info->counter = &recorder->counter;
+    timer_info->overflows = &recorder->overflows;
+    recorder->timer_info = timer_info;
+
+    software_timer_timer_info_flag_t flags = software_timer_timer_info_init(timer_info);
+
+    software_timer_recorder_rewind(recorder);
+    recorder->size = size;
+
+    return flags;
+}
+
+void software_timer_recorder_rewind (software_timer_recorder_t * recorder)
+{
+    if(NULL != recorder->source)
+    {
+        recorder->size = 0;
+    }
+
+    recorder->position = 0;
+    recorder->samples = 0;
+    recorder->full = false;
+
+    software_timer_recorder_set_ticks(recorder, 0);
+}
+
+bool software_timer_recorder_sample (software_timer_recorder_t * recorder)
+{
+    uint64_t value;
+
+    if(NULL == recorder->source)
+    {
+        size_t length = software_timer_varint_read(&recorder->buffer[recorder->position], recorder->size - recorder->position, &value);
+
+        if(0 == length)
+        {
+            return false;
+        }
+
+        recorder->position += length;
+        ++recorder->samples;
+
+        software_timer_recorder_set_ticks(recorder, recorder->ticks + (uint64_t)software_timer_varint_zigzag_decode(value));
+
+        return true;
+    }
+
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(recorder->source, &timestamp);
+    uint64_t ticks = software_timer_get_ticks(&timestamp);
+
+    // The difference is signed, so that a counter that runs backwards is recorded as well
+    value = software_timer_varint_zigzag_encode((int64_t)(ticks - recorder->ticks));
+
+    // No further sample is written once one is missing, the next difference would refer to it
+    size_t length = recorder->full ? 0 : software_timer_varint_write(&recorder->buffer[recorder->size], recorder->capacity - recorder->size, value);
+
+    software_timer_recorder_set_ticks(recorder, ticks);
+
+    if(0 == length)
+    {
+        recorder->full = true;
+        return false;
+    }
+
+    recorder->size += length;
+    ++recorder->samples;
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
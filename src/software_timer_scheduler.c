@@ -0,0 +1,188 @@
+//! @file
+//! @brief The software_timer_scheduler source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_scheduler.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_scheduler_sc software_timer_scheduler =
+{
+    software_timer_scheduler_dispatch,
+    software_timer_scheduler_init,
+    software_timer_scheduler_reset_statistics,
+    software_timer_scheduler_start,
+    software_timer_scheduler_task_init,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static uint64_t software_timer_scheduler_period (const software_timer_task_t * task);
+static bool software_timer_scheduler_before (const software_timer_task_t * a, const software_timer_task_t * b);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Returns the period of the task in ticks
+static uint64_t software_timer_scheduler_period (const software_timer_task_t * task)
+{
+    return task->timer.duration_overflows * task->timer.timer_info->period + task->timer.duration_counter;
+}
+
+//! @brief Returns `true` if task `a` has a higher rate-monotonic priority than task `b`
+static bool software_timer_scheduler_before (const software_timer_task_t * a, const software_timer_task_t * b)
+{
+    uint64_t period_a = software_timer_scheduler_period(a);
+    uint64_t period_b = software_timer_scheduler_period(b);
+
+    return (period_a < period_b) || ((period_a == period_b) && (a->priority < b->priority));
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_task_t * software_timer_scheduler_dispatch (software_timer_scheduler_t * scheduler)
+{
+    for(uint32_t index = 0; index < scheduler->count; ++index)
+    {
+        software_timer_task_t * task = &scheduler->tasks[index];
+
+        // The end value before the restart is the release time of this run
+        software_timer_timestamp_t release;
+        release.counter = task->timer.end_counter;
+        release.overflows = task->timer.end_overflows;
+        release.timer_info = task->timer.timer_info;
+
+        if(software_timer_elapsed(&task->timer))
+        {
+            software_timer_timestamp_t start;
+            software_timer_timestamp_t end;
+
+            software_timer_get_timestamp(&task->timer, &start);
+            task->function(task);
+            software_timer_get_timestamp(&task->timer, &end);
+
+            uint64_t end_ticks = software_timer_get_ticks(&end);
+
+            task->execution_ticks = end_ticks - software_timer_get_ticks(&start);
+            task->wcet_ticks = (task->execution_ticks > task->wcet_ticks) ? task->execution_ticks : task->wcet_ticks;
+            task->overrun = (end_ticks - software_timer_get_ticks(&release)) > task->deadline;
+            ++task->runs;
+
+            if(task->overrun)
+            {
+                ++task->overruns;
+
+                if(NULL != scheduler->on_overrun) { scheduler->on_overrun(task); }
+            }
+
+            return task;
+        }
+    }
+
+    return NULL;
+}
+
+void software_timer_scheduler_init (software_timer_scheduler_t * scheduler, software_timer_task_t * tasks, uint32_t count, const software_timer_timer_info_t * timer_info, software_timer_task_function_t on_overrun)
+{
+    scheduler->tasks = tasks;
+    scheduler->count = count;
+    scheduler->timer_info = timer_info;
+    scheduler->on_overrun = on_overrun;
+
+    // Insertion sort, the table is small and sorted only once
+    for(uint32_t index = 1; index < count; ++index)
+    {
+        software_timer_task_t task = tasks[index];
+        uint32_t position = index;
+
+        while(position > 0 && software_timer_scheduler_before(&task, &tasks[position - 1]))
+        {
+            tasks[position] = tasks[position - 1];
+            --position;
+        }
+
+        tasks[position] = task;
+    }
+}
+
+void software_timer_scheduler_reset_statistics (software_timer_scheduler_t * scheduler)
+{
+    for(uint32_t index = 0; index < scheduler->count; ++index)
+    {
+        software_timer_task_t * task = &scheduler->tasks[index];
+
+        task->execution_ticks = 0;
+        task->wcet_ticks = 0;
+        task->runs = 0;
+        task->overruns = 0;
+        task->overrun = false;
+    }
+}
+
+void software_timer_scheduler_start (software_timer_scheduler_t * scheduler)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(scheduler->timer_info, &timestamp);
+
+    for(uint32_t index = 0; index < scheduler->count; ++index)
+    {
+        software_timer_start_batch_at(&scheduler->tasks[index].timer, 1, &timestamp);
+    }
+}
+
+software_timer_duration_flag_t software_timer_scheduler_task_init (software_timer_task_t * task, const software_timer_timer_info_t * timer_info, double period_in_seconds, double deadline_in_seconds, uint8_t priority, software_timer_task_function_t function)
+{
+    software_timer_init_halt(&task->timer, timer_info);
+    software_timer_duration_flag_t flags = software_timer_calculate_and_set_duration(&task->timer, period_in_seconds);
+
+    task->function = function;
+    task->user_data = NULL;
+    task->priority = priority;
+    task->deadline = software_timer_scheduler_period(task);
+
+    if(0 != deadline_in_seconds)
+    {
+        software_timer_duration_t deadline;
+        flags = (software_timer_duration_flag_t) (flags | software_timer_calculate_duration(timer_info, deadline_in_seconds, &deadline));
+
+        task->deadline = deadline.duration_overflows * timer_info->period + deadline.duration_counter;
+    }
+
+    task->execution_ticks = 0;
+    task->wcet_ticks = 0;
+    task->runs = 0;
+    task->overruns = 0;
+    task->overrun = false;
+
+    return flags;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
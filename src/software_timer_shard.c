@@ -0,0 +1,211 @@
+//! @file
+//! @brief The software_timer_shard source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "software_timer_shard.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_shard_sc software_timer_shard =
+{
+    software_timer_shard_current,
+    software_timer_shard_init,
+    software_timer_shard_migrate,
+    software_timer_shard_poll,
+    software_timer_shard_receive,
+    software_timer_shard_send,
+    software_timer_shard_snapshot,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+software_timer_shard_t * software_timer_shard_current (software_timer_shard_t * shards, uint32_t count)
+{
+#if defined(__linux__)
+
+    int cpu = sched_getcpu();
+
+    if(cpu >= 0)
+    {
+        return &shards[(uint32_t)cpu % count];
+    }
+
+#else
+
+    (void)count;
+
+#endif
+
+    return &shards[0];
+}
+
+bool software_timer_shard_init (software_timer_shard_t * shard, const software_timer_timer_info_t * source, software_timer_t * timers, uint16_t * generations, uint32_t capacity, software_timer_shard_message_t * messages, uint32_t message_capacity)
+{
+    if(0 == message_capacity || 0 != (message_capacity & (message_capacity - 1)))
+    {
+        return false;
+    }
+
+    shard->source = source;
+    shard->timer_info = *source;
+    shard->timer_info.counter = &shard->counter;
+    shard->timer_info.overflows = &shard->overflows;
+    software_timer_timer_info_init(&shard->timer_info);
+
+    software_timer_shard_snapshot(shard);
+
+    for(uint32_t index = 0; index < message_capacity; ++index)
+    {
+        messages[index].sequence = index;
+    }
+
+    shard->messages = messages;
+    shard->mask = message_capacity - 1;
+    shard->head = 0;
+    shard->tail = 0;
+    shard->on_receive = NULL;
+    shard->user_data = NULL;
+
+    return software_timer_pool_init(&shard->pool, timers, generations, capacity, &shard->timer_info);
+}
+
+bool software_timer_shard_migrate (software_timer_shard_t * shard, software_timer_handle_t handle, software_timer_shard_t * destination)
+{
+    software_timer_t * timer = software_timer_pool_get(&shard->pool, handle);
+
+    if(NULL == timer || !software_timer_shard_send(destination, timer))
+    {
+        return false;
+    }
+
+    return software_timer_pool_free(&shard->pool, handle);
+}
+
+uint32_t software_timer_shard_poll (software_timer_shard_t * shard)
+{
+    software_timer_shard_snapshot(shard);
+    software_timer_shard_receive(shard);
+
+    return software_timer_pool_poll(&shard->pool);
+}
+
+uint32_t software_timer_shard_receive (software_timer_shard_t * shard)
+{
+    uint32_t received = 0;
+
+    for(;;)
+    {
+        uint32_t head = shard->head;
+        software_timer_shard_message_t * message = &shard->messages[head & shard->mask];
+
+        if(head + 1 != __atomic_load_n(&message->sequence, __ATOMIC_ACQUIRE))
+        {
+            break;
+        }
+
+        software_timer_handle_t handle = software_timer_pool_alloc(&shard->pool);
+
+        if(SOFTWARE_TIMER_POOL_INVALID_HANDLE == handle)
+        {
+            break;
+        }
+
+        software_timer_t * timer = software_timer_pool_get(&shard->pool, handle);
+        *timer = message->timer;
+        timer->timer_info = &shard->timer_info;
+
+        // The element is released for the senders of the next round
+        __atomic_store_n(&message->sequence, head + shard->mask + 1, __ATOMIC_RELEASE);
+        shard->head = head + 1;
+        ++received;
+
+        if(NULL != shard->on_receive)
+        {
+            shard->on_receive(shard, handle);
+        }
+    }
+
+    return received;
+}
+
+bool software_timer_shard_send (software_timer_shard_t * destination, const software_timer_t * timer)
+{
+    uint32_t tail = __atomic_load_n(&destination->tail, __ATOMIC_RELAXED);
+    software_timer_shard_message_t * message;
+
+    for(;;)
+    {
+        message = &destination->messages[tail & destination->mask];
+        int32_t difference = (int32_t)(__atomic_load_n(&message->sequence, __ATOMIC_ACQUIRE) - tail);
+
+        if(0 == difference)
+        {
+            // The element is free, it is reserved by advancing the tail
+            if(__atomic_compare_exchange_n(&destination->tail, &tail, tail + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if(difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            tail = __atomic_load_n(&destination->tail, __ATOMIC_RELAXED);
+        }
+    }
+
+    message->timer = *timer;
+    __atomic_store_n(&message->sequence, tail + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+void software_timer_shard_snapshot (software_timer_shard_t * shard)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(shard->source, &timestamp);
+
+    shard->overflows = timestamp.overflows;
+    shard->counter = timestamp.counter;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,257 @@
+//! @file
+//! @brief The software_timer_shm source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "software_timer_shm.h"
+#include "software_timer_host.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_shm_sc software_timer_shm =
+{
+    software_timer_shm_attach,
+    software_timer_shm_close,
+    software_timer_shm_create,
+    software_timer_shm_publish,
+    software_timer_shm_read,
+    software_timer_shm_snapshot,
+    software_timer_shm_update,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static void software_timer_shm_connect (software_timer_shm_t * shm, software_timer_timer_info_t * timer_info);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Points the timer data to the local copy and takes the first snapshot
+static void software_timer_shm_connect (software_timer_shm_t * shm, software_timer_timer_info_t * timer_info)
+{
+    timer_info->counter = &shm->counter;
+    timer_info->overflows = &shm->overflows;
+    software_timer_timer_info_init(timer_info);
+
+    shm->timer_info = timer_info;
+    software_timer_shm_snapshot(shm);
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_shm_attach (software_timer_shm_t * shm, const char * name, software_timer_timer_info_t * timer_info)
+{
+    shm->region = NULL;
+    shm->name = NULL;
+    shm->epoch_ns = 0;
+
+    int file = shm_open(name, O_RDONLY, 0);
+
+    if(-1 == file)
+    {
+        return false;
+    }
+
+    // The consumers only read, the timers use the local copy
+    void * memory = mmap(NULL, sizeof(software_timer_shm_region_t), PROT_READ, MAP_SHARED, file, 0);
+    int error = errno;
+    close(file);
+
+    if(MAP_FAILED == memory)
+    {
+        errno = error;
+        return false;
+    }
+
+    shm->region = (software_timer_shm_region_t *)memory;
+    const software_timer_shm_region_t * region = shm->region;
+
+    if(SOFTWARE_TIMER_SHM_MAGIC != __atomic_load_n(&region->magic, __ATOMIC_ACQUIRE))
+    {
+        software_timer_shm_close(shm);
+        errno = EAGAIN;
+        return false;
+    }
+
+    timer_info->capture_compare = region->capture_compare;
+    timer_info->prescaler = region->prescaler;
+    timer_info->ticks_per_second = region->ticks_per_second;
+    software_timer_shm_connect(shm, timer_info);
+
+    return true;
+}
+
+void software_timer_shm_close (software_timer_shm_t * shm)
+{
+    if(NULL == shm->region)
+    {
+        return;
+    }
+
+    munmap(shm->region, sizeof(software_timer_shm_region_t));
+    shm->region = NULL;
+
+    if(NULL != shm->name)
+    {
+        shm_unlink(shm->name);
+        shm->name = NULL;
+    }
+}
+
+bool software_timer_shm_create (software_timer_shm_t * shm, const char * name, software_timer_timer_info_t * timer_info)
+{
+    shm->region = NULL;
+    shm->name = NULL;
+
+    int file = shm_open(name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if(-1 == file)
+    {
+        return false;
+    }
+
+    if(0 != ftruncate(file, sizeof(software_timer_shm_region_t)))
+    {
+        int error = errno;
+        close(file);
+        shm_unlink(name);
+        errno = error;
+        return false;
+    }
+
+    void * memory = mmap(NULL, sizeof(software_timer_shm_region_t), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    int error = errno;
+    close(file);
+
+    if(MAP_FAILED == memory)
+    {
+        shm_unlink(name);
+        errno = error;
+        return false;
+    }
+
+    shm->region = (software_timer_shm_region_t *)memory;
+    shm->name = name;
+
+    software_timer_shm_region_t * region = shm->region;
+    region->sequence = 0;
+    region->counter = 0;
+    region->overflows = 0;
+    region->capture_compare = timer_info->capture_compare;
+    region->prescaler = timer_info->prescaler;
+    region->ticks_per_second = timer_info->ticks_per_second;
+
+    software_timer_shm_connect(shm, timer_info);
+    shm->epoch_ns = software_timer_host_monotonic_ns();
+
+    // A consumer accepts the shared memory only after the configuration is complete
+    __atomic_store_n(&region->magic, SOFTWARE_TIMER_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+void software_timer_shm_publish (software_timer_shm_t * shm, uint64_t ticks)
+{
+    software_timer_shm_region_t * region = shm->region;
+
+    software_timer_timestamp_t timestamp;
+    timestamp.timer_info = shm->timer_info;
+    software_timer_set_ticks(&timestamp, ticks);
+
+    uint32_t sequence = region->sequence;
+
+    __atomic_store_n(&region->sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    __atomic_store_n(&region->counter, timestamp.counter, __ATOMIC_RELAXED);
+    __atomic_store_n(&region->overflows, timestamp.overflows, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&region->sequence, sequence + 2, __ATOMIC_RELEASE);
+
+    // The counter is written first, as by a hardware timer
+    shm->counter = timestamp.counter;
+    shm->overflows = timestamp.overflows;
+}
+
+void software_timer_shm_read (const software_timer_shm_t * shm, software_timer_timestamp_t * timestamp)
+{
+    const software_timer_shm_region_t * region = shm->region;
+    uint32_t begin;
+    uint32_t end;
+
+    do
+    {
+        begin = __atomic_load_n(&region->sequence, __ATOMIC_ACQUIRE);
+
+        timestamp->overflows = __atomic_load_n(&region->overflows, __ATOMIC_RELAXED);
+        timestamp->counter = __atomic_load_n(&region->counter, __ATOMIC_RELAXED);
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = __atomic_load_n(&region->sequence, __ATOMIC_RELAXED);
+
+    }while((begin & 1) || begin != end);
+
+    timestamp->timer_info = shm->timer_info;
+}
+
+void software_timer_shm_snapshot (software_timer_shm_t * shm)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_shm_read(shm, &timestamp);
+
+    shm->counter = timestamp.counter;
+    shm->overflows = timestamp.overflows;
+}
+
+uint64_t software_timer_shm_update (software_timer_shm_t * shm)
+{
+    uint64_t ticks = software_timer_host_ns_to_ticks(software_timer_host_monotonic_ns() - shm->epoch_ns, shm->region->ticks_per_second);
+
+    software_timer_shm_publish(shm, ticks);
+
+    return ticks;
+}
+
+
+#endif /* defined(__linux__) */
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,239 @@
+//! @file
+//! @brief The software_timer_stopwatch source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "software_timer_stopwatch.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_stopwatch_sc software_timer_stopwatch =
+{
+    software_timer_stopwatch_calibrate,
+    software_timer_stopwatch_get_mean_ns,
+    software_timer_stopwatch_init,
+    software_timer_stopwatch_interval,
+    software_timer_stopwatch_reset,
+    software_timer_stopwatch_site,
+    software_timer_stopwatch_start,
+    software_timer_stopwatch_stop,
+    software_timer_stopwatch_ticks_to_ns,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static void software_timer_stopwatch_clear (software_timer_stopwatch_site_t * site);
+static INLINE uint64_t software_timer_stopwatch_ticks (const software_timer_timer_info_t * timer_info, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end, uint64_t overhead);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Resets the statistics of the site
+static void software_timer_stopwatch_clear (software_timer_stopwatch_site_t * site)
+{
+    site->count = 0;
+    site->min = UINT64_MAX;
+    site->max = 0;
+    site->sum = 0;
+}
+
+//! @brief Calculates the ticks between two timestamps minus the overhead
+static INLINE uint64_t software_timer_stopwatch_ticks (const software_timer_timer_info_t * timer_info, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end, uint64_t overhead)
+{
+    // The counter difference may be negative, the sum is correct with unsigned wrap-around
+    uint64_t ticks = (end->overflows - start->overflows) * timer_info->period
+                   + end->counter - start->counter;
+
+    return (ticks > overhead) ? (ticks - overhead) : 0;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+void software_timer_stopwatch_calibrate (software_timer_stopwatch_table_t * table, uint64_t * samples, uint32_t count, software_timer_stopwatch_calibration_t * calibration)
+{
+    // A site without overhead delivers the raw ticks
+    software_timer_stopwatch_site_t site;
+    site.name = NULL;
+    site.timer_info = table->timer_info;
+    site.overhead = 0;
+    software_timer_stopwatch_clear(&site);
+
+    software_timer_stopwatch_t stopwatch;
+
+    for(uint32_t index = 0; index < count; ++index)
+    {
+        software_timer_stopwatch_start(&stopwatch, &site);
+        samples[index] = software_timer_stopwatch_stop(&stopwatch);
+    }
+
+    // Insertion sort, only used once at startup
+    for(uint32_t index = 1; index < count; ++index)
+    {
+        uint64_t sample = samples[index];
+        uint32_t position = index;
+
+        while(position > 0 && sample < samples[position - 1])
+        {
+            samples[position] = samples[position - 1];
+            --position;
+        }
+
+        samples[position] = sample;
+    }
+
+    calibration->overhead_min = (0 == count) ? 0 : samples[0];
+    calibration->overhead_median = (0 == count) ? 0 : samples[count / 2];
+    calibration->resolution_ticks = UINT64_MAX;
+
+    // The resolution is the smallest step between consecutive raw timestamps, without the overhead
+    software_timer_timestamp_t previous;
+    software_timer_timestamp_t current;
+    software_timer_timer_info_get_timestamp(table->timer_info, &previous);
+
+    for(uint32_t index = 0; index < count; ++index)
+    {
+        software_timer_timer_info_get_timestamp(table->timer_info, &current);
+        uint64_t ticks = software_timer_stopwatch_ticks(table->timer_info, &previous, &current, 0);
+
+        if(0 != ticks && ticks < calibration->resolution_ticks)
+        {
+            calibration->resolution_ticks = ticks;
+        }
+
+        previous = current;
+    }
+
+    if(UINT64_MAX == calibration->resolution_ticks)
+    {
+        calibration->resolution_ticks = 1;
+    }
+
+    calibration->resolution_ns = software_timer_stopwatch_ticks_to_ns(table->timer_info, calibration->resolution_ticks);
+
+    table->overhead = calibration->overhead_min;
+
+    for(uint32_t index = 0; index < table->count; ++index)
+    {
+        table->sites[index].overhead = table->overhead;
+    }
+}
+
+uint64_t software_timer_stopwatch_get_mean_ns (const software_timer_stopwatch_site_t * site)
+{
+    if(0 == site->count)
+    {
+        return 0;
+    }
+
+    return software_timer_stopwatch_ticks_to_ns(site->timer_info, site->sum / site->count);
+}
+
+void software_timer_stopwatch_init (software_timer_stopwatch_table_t * table, software_timer_stopwatch_site_t * sites, uint32_t capacity, const software_timer_timer_info_t * timer_info)
+{
+    table->sites = sites;
+    table->capacity = capacity;
+    table->count = 0;
+    table->timer_info = timer_info;
+    table->overhead = 0;
+}
+
+uint64_t software_timer_stopwatch_interval (const software_timer_stopwatch_table_t * table, const software_timer_timestamp_t * start, const software_timer_timestamp_t * end)
+{
+    return software_timer_stopwatch_ticks(table->timer_info, start, end, table->overhead);
+}
+
+void software_timer_stopwatch_reset (software_timer_stopwatch_table_t * table)
+{
+    for(uint32_t index = 0; index < table->count; ++index)
+    {
+        software_timer_stopwatch_clear(&table->sites[index]);
+    }
+}
+
+software_timer_stopwatch_site_t * software_timer_stopwatch_site (software_timer_stopwatch_table_t * table, const char * name)
+{
+    for(uint32_t index = 0; index < table->count; ++index)
+    {
+        if(0 == strcmp(table->sites[index].name, name))
+        {
+            return &table->sites[index];
+        }
+    }
+
+    if(table->count >= table->capacity)
+    {
+        return NULL;
+    }
+
+    software_timer_stopwatch_site_t * site = &table->sites[table->count++];
+
+    site->name = name;
+    site->timer_info = table->timer_info;
+    site->overhead = table->overhead;
+    software_timer_stopwatch_clear(site);
+
+    return site;
+}
+
+void software_timer_stopwatch_start (software_timer_stopwatch_t * stopwatch, software_timer_stopwatch_site_t * site)
+{
+    stopwatch->site = site;
+    software_timer_timer_info_get_timestamp(site->timer_info, &stopwatch->start);
+}
+
+uint64_t software_timer_stopwatch_stop (software_timer_stopwatch_t * stopwatch)
+{
+    software_timer_stopwatch_site_t * site = stopwatch->site;
+
+    software_timer_timestamp_t end;
+    software_timer_timer_info_get_timestamp(site->timer_info, &end);
+
+    uint64_t ticks = software_timer_stopwatch_ticks(site->timer_info, &stopwatch->start, &end, site->overhead);
+
+    ++site->count;
+    site->sum += ticks;
+    site->min = (ticks < site->min) ? ticks : site->min;
+    site->max = (ticks > site->max) ? ticks : site->max;
+
+    return ticks;
+}
+
+uint64_t software_timer_stopwatch_ticks_to_ns (const software_timer_timer_info_t * timer_info, uint64_t ticks)
+{
+    software_timer_timestamp_t timestamp;
+    timestamp.timer_info = timer_info;
+    software_timer_set_ticks(&timestamp, ticks);
+
+    return software_timer_get_ns(&timestamp);
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,336 @@
+//! @file
+//! @brief The software_timer_timeout source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <limits.h>
+
+#include "software_timer_timeout.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+//! @brief Value of ::software_timer_timeout_entry_s::scheduled of an inactive timeout
+#define SOFTWARE_TIMER_TIMEOUT_INACTIVE (UINT64_MAX)
+
+//! @brief Value of ::software_timer_timeout_entry_s::scheduled of an expired timeout whose handler is pending
+#define SOFTWARE_TIMER_TIMEOUT_EXPIRING (UINT64_MAX - 1)
+
+//! @brief Latest deadline, so that the bucket tick stays below the markers even without a resolution shift
+#define SOFTWARE_TIMER_TIMEOUT_MAX_DEADLINE (UINT64_MAX - 2)
+
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_timeout_sc software_timer_timeout =
+{
+    software_timer_timeout_cancel,
+    software_timer_timeout_expire,
+    software_timer_timeout_init,
+    software_timer_timeout_is_active,
+    software_timer_timeout_next_timeout,
+    software_timer_timeout_reset,
+    software_timer_timeout_wait_ms,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static uint64_t software_timer_timeout_now (const software_timer_timeout_t * manager);
+static INLINE uint32_t * software_timer_timeout_head (software_timer_timeout_t * manager, uint64_t scheduled);
+static void software_timer_timeout_link (software_timer_timeout_t * manager, uint32_t index, uint64_t scheduled);
+static void software_timer_timeout_unlink (software_timer_timeout_t * manager, uint32_t index);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Reads the current time in ticks
+static uint64_t software_timer_timeout_now (const software_timer_timeout_t * manager)
+{
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(manager->timer_info, &timestamp);
+
+    return software_timer_get_ticks(&timestamp);
+}
+
+//! @brief Returns the first entry of the list of a bucket tick or of the expired timeouts
+static INLINE uint32_t * software_timer_timeout_head (software_timer_timeout_t * manager, uint64_t scheduled)
+{
+    if(SOFTWARE_TIMER_TIMEOUT_EXPIRING == scheduled)
+    {
+        return &manager->expired;
+    }
+
+    return &manager->buckets[scheduled & manager->mask];
+}
+
+//! @brief Inserts the entry at the front of the list
+static void software_timer_timeout_link (software_timer_timeout_t * manager, uint32_t index, uint64_t scheduled)
+{
+    software_timer_timeout_entry_t * entry = &manager->entries[index];
+    uint32_t * head = software_timer_timeout_head(manager, scheduled);
+
+    entry->scheduled = scheduled;
+    entry->previous = SOFTWARE_TIMER_TIMEOUT_NONE;
+    entry->next = *head;
+
+    if(SOFTWARE_TIMER_TIMEOUT_NONE != entry->next)
+    {
+        manager->entries[entry->next].previous = index;
+    }
+
+    *head = index;
+}
+
+//! @brief Removes the entry from its list
+static void software_timer_timeout_unlink (software_timer_timeout_t * manager, uint32_t index)
+{
+    software_timer_timeout_entry_t * entry = &manager->entries[index];
+
+    if(SOFTWARE_TIMER_TIMEOUT_NONE != entry->previous)
+    {
+        manager->entries[entry->previous].next = entry->next;
+    }
+    else
+    {
+        *software_timer_timeout_head(manager, entry->scheduled) = entry->next;
+    }
+
+    if(SOFTWARE_TIMER_TIMEOUT_NONE != entry->next)
+    {
+        manager->entries[entry->next].previous = entry->previous;
+    }
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_timeout_cancel (software_timer_timeout_t * manager, uint32_t index)
+{
+    if(index >= manager->capacity || SOFTWARE_TIMER_TIMEOUT_INACTIVE == manager->entries[index].scheduled)
+    {
+        return false;
+    }
+
+    software_timer_timeout_unlink(manager, index);
+    manager->entries[index].scheduled = SOFTWARE_TIMER_TIMEOUT_INACTIVE;
+    --manager->count;
+
+    return true;
+}
+
+uint32_t software_timer_timeout_expire (software_timer_timeout_t * manager)
+{
+    uint64_t now = software_timer_timeout_now(manager);
+    uint64_t target = now >> manager->resolution_shift;
+
+    // Each bucket is processed at most once, even after a long time without a call
+    uint64_t tick = (target - manager->current > manager->mask) ? (target - manager->mask) : manager->current;
+
+    for(; tick <= target; ++tick)
+    {
+        uint32_t index = manager->buckets[tick & manager->mask];
+
+        while(SOFTWARE_TIMER_TIMEOUT_NONE != index)
+        {
+            software_timer_timeout_entry_t * entry = &manager->entries[index];
+            uint32_t next = entry->next;
+
+            if(entry->deadline <= now)
+            {
+                software_timer_timeout_unlink(manager, index);
+                software_timer_timeout_link(manager, index, SOFTWARE_TIMER_TIMEOUT_EXPIRING);
+            }
+            else
+            {
+                // The deadline was reset lazily, the entry moves to the bucket of its deadline
+                uint64_t scheduled = entry->deadline >> manager->resolution_shift;
+
+                if(0 != ((scheduled ^ tick) & manager->mask))
+                {
+                    software_timer_timeout_unlink(manager, index);
+                    software_timer_timeout_link(manager, index, scheduled);
+                }
+                else
+                {
+                    entry->scheduled = scheduled;
+                }
+            }
+
+            index = next;
+        }
+    }
+
+    manager->current = target;
+
+    // The handlers are called last, so that they can change any entry
+    uint32_t expired = 0;
+
+    while(SOFTWARE_TIMER_TIMEOUT_NONE != manager->expired)
+    {
+        uint32_t index = manager->expired;
+
+        software_timer_timeout_unlink(manager, index);
+        manager->entries[index].scheduled = SOFTWARE_TIMER_TIMEOUT_INACTIVE;
+        --manager->count;
+        ++expired;
+
+        if(NULL != manager->on_timeout)
+        {
+            manager->on_timeout(manager, index);
+        }
+    }
+
+    return expired;
+}
+
+bool software_timer_timeout_init (software_timer_timeout_t * manager, const software_timer_timer_info_t * timer_info, software_timer_timeout_entry_t * entries, uint32_t capacity, uint32_t * buckets, uint32_t bucket_count, uint32_t resolution_shift)
+{
+    if(0 == bucket_count || 0 != (bucket_count & (bucket_count - 1)) || resolution_shift >= 64 || SOFTWARE_TIMER_TIMEOUT_NONE == capacity)
+    {
+        return false;
+    }
+
+    for(uint32_t index = 0; index < capacity; ++index)
+    {
+        entries[index].scheduled = SOFTWARE_TIMER_TIMEOUT_INACTIVE;
+        entries[index].user_data = NULL;
+    }
+
+    for(uint32_t index = 0; index < bucket_count; ++index)
+    {
+        buckets[index] = SOFTWARE_TIMER_TIMEOUT_NONE;
+    }
+
+    manager->timer_info = timer_info;
+    manager->entries = entries;
+    manager->capacity = capacity;
+    manager->buckets = buckets;
+    manager->mask = bucket_count - 1;
+    manager->resolution_shift = resolution_shift;
+    manager->expired = SOFTWARE_TIMER_TIMEOUT_NONE;
+    manager->count = 0;
+    manager->current = software_timer_timeout_now(manager) >> resolution_shift;
+    manager->on_timeout = NULL;
+
+    return true;
+}
+
+bool software_timer_timeout_is_active (const software_timer_timeout_t * manager, uint32_t index)
+{
+    return (index < manager->capacity) && (SOFTWARE_TIMER_TIMEOUT_INACTIVE != manager->entries[index].scheduled);
+}
+
+uint64_t software_timer_timeout_next_timeout (const software_timer_timeout_t * manager)
+{
+    if(0 == manager->count)
+    {
+        return UINT64_MAX;
+    }
+
+    if(SOFTWARE_TIMER_TIMEOUT_NONE != manager->expired)
+    {
+        return 0;
+    }
+
+    uint64_t earliest = UINT64_MAX;
+
+    // The entries of the current bucket are not reset lazily, so only their deadlines are compared
+    uint32_t index = manager->buckets[manager->current & manager->mask];
+
+    while(SOFTWARE_TIMER_TIMEOUT_NONE != index)
+    {
+        const software_timer_timeout_entry_t * entry = &manager->entries[index];
+        earliest = (entry->deadline < earliest) ? entry->deadline : earliest;
+        index = entry->next;
+    }
+
+    // The entries of a later bucket expire at its start or later, the start is a lower bound
+    for(uint64_t tick = manager->current + 1; tick <= manager->current + manager->mask; ++tick)
+    {
+        if(SOFTWARE_TIMER_TIMEOUT_NONE != manager->buckets[tick & manager->mask])
+        {
+            uint64_t start = tick << manager->resolution_shift;
+            earliest = (start < earliest) ? start : earliest;
+            break;
+        }
+    }
+
+    uint64_t now = software_timer_timeout_now(manager);
+
+    return (earliest <= now) ? 0 : (earliest - now);
+}
+
+bool software_timer_timeout_reset (software_timer_timeout_t * manager, uint32_t index, uint64_t timeout_ticks)
+{
+    if(index >= manager->capacity)
+    {
+        return false;
+    }
+
+    software_timer_timeout_entry_t * entry = &manager->entries[index];
+    uint64_t now = software_timer_timeout_now(manager);
+    uint64_t deadline = (now >= SOFTWARE_TIMER_TIMEOUT_MAX_DEADLINE || timeout_ticks > SOFTWARE_TIMER_TIMEOUT_MAX_DEADLINE - now) ?
+                        SOFTWARE_TIMER_TIMEOUT_MAX_DEADLINE : (now + timeout_ticks);
+    uint64_t scheduled = deadline >> manager->resolution_shift;
+
+    entry->deadline = deadline;
+
+    if(SOFTWARE_TIMER_TIMEOUT_INACTIVE == entry->scheduled)
+    {
+        ++manager->count;
+    }
+    else if(SOFTWARE_TIMER_TIMEOUT_EXPIRING != entry->scheduled && entry->scheduled > manager->current && scheduled >= entry->scheduled)
+    {
+        // The entry is found in its bucket and moved later, the current bucket stays exact
+        return true;
+    }
+    else
+    {
+        software_timer_timeout_unlink(manager, index);
+    }
+
+    software_timer_timeout_link(manager, index, (scheduled < manager->current) ? manager->current : scheduled);
+
+    return true;
+}
+
+int software_timer_timeout_wait_ms (const software_timer_timeout_t * manager)
+{
+    uint64_t ticks = software_timer_timeout_next_timeout(manager);
+
+    if(UINT64_MAX == ticks)
+    {
+        return -1;
+    }
+
+    uint64_t ticks_per_second = manager->timer_info->ticks_per_second;
+    uint64_t ms = (ticks / ticks_per_second) * 1000 + ((ticks % ticks_per_second) * 1000 + ticks_per_second - 1) / ticks_per_second;
+
+    return (ms > INT_MAX) ? INT_MAX : (int)ms;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
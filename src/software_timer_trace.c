@@ -0,0 +1,249 @@
+//! @file
+//! @brief The software_timer_trace source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "software_timer_trace.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_trace_sc software_timer_trace =
+{
+    software_timer_trace_close,
+    software_timer_trace_create,
+    software_timer_trace_dropped,
+    software_timer_trace_next,
+    software_timer_trace_open,
+    software_timer_trace_record,
+    software_timer_trace_record_timer,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+
+static bool software_timer_trace_map (software_timer_trace_t * trace, int file, size_t size, int protection);
+
+
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+//! @brief Maps the file, it is closed on failure
+static bool software_timer_trace_map (software_timer_trace_t * trace, int file, size_t size, int protection)
+{
+    void * memory = mmap(NULL, size, protection, MAP_SHARED, file, 0);
+
+    if(MAP_FAILED == memory)
+    {
+        int error = errno;
+        close(file);
+        errno = error;
+        trace->file = -1;
+        return false;
+    }
+
+    trace->header = (software_timer_trace_header_t *)memory;
+    trace->records = (software_timer_trace_record_t *)(trace->header + 1);
+    trace->size = size;
+    trace->file = file;
+    trace->position = 0;
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+void software_timer_trace_close (software_timer_trace_t * trace)
+{
+    if(-1 == trace->file)
+    {
+        return;
+    }
+
+    munmap(trace->header, trace->size);
+    close(trace->file);
+
+    trace->header = NULL;
+    trace->records = NULL;
+    trace->file = -1;
+}
+
+bool software_timer_trace_create (software_timer_trace_t * trace, const char * path, uint32_t capacity, const software_timer_timer_info_t * timer_info)
+{
+    trace->file = -1;
+    trace->timer_info = timer_info;
+
+    int file = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if(-1 == file)
+    {
+        return false;
+    }
+
+    size_t size = sizeof(software_timer_trace_header_t) + (size_t)capacity * sizeof(software_timer_trace_record_t);
+
+    // The blocks are allocated now, so that writing a record never waits for the file system
+    int error = posix_fallocate(file, 0, (off_t)size);
+
+    if(0 != error)
+    {
+        close(file);
+        errno = error;
+        return false;
+    }
+
+    if(!software_timer_trace_map(trace, file, size, PROT_READ | PROT_WRITE))
+    {
+        return false;
+    }
+
+    software_timer_trace_header_t * header = trace->header;
+    header->record_size = sizeof(software_timer_trace_record_t);
+    header->capacity = capacity;
+    header->cursor = 0;
+    header->ticks_per_second = timer_info->ticks_per_second;
+
+    // A reader accepts the file only after the header is complete
+    __atomic_store_n(&header->magic, SOFTWARE_TIMER_TRACE_MAGIC, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+uint64_t software_timer_trace_dropped (const software_timer_trace_t * trace)
+{
+    uint64_t cursor = __atomic_load_n(&trace->header->cursor, __ATOMIC_RELAXED);
+    uint64_t capacity = trace->header->capacity;
+
+    return (cursor > capacity) ? (cursor - capacity) : 0;
+}
+
+bool software_timer_trace_next (software_timer_trace_t * trace, software_timer_trace_record_t * record)
+{
+    uint32_t position = trace->position;
+
+    if(position >= trace->header->capacity)
+    {
+        return false;
+    }
+
+    const software_timer_trace_record_t * next = &trace->records[position];
+
+    if(position + 1 != __atomic_load_n(&next->sequence, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+
+    *record = *next;
+    trace->position = position + 1;
+
+    return true;
+}
+
+bool software_timer_trace_open (software_timer_trace_t * trace, const char * path)
+{
+    trace->file = -1;
+    trace->timer_info = NULL;
+
+    int file = open(path, O_RDONLY | O_CLOEXEC);
+
+    if(-1 == file)
+    {
+        return false;
+    }
+
+    struct stat status;
+
+    if(0 != fstat(file, &status) || (size_t)status.st_size < sizeof(software_timer_trace_header_t))
+    {
+        close(file);
+        errno = EINVAL;
+        return false;
+    }
+
+    if(!software_timer_trace_map(trace, file, (size_t)status.st_size, PROT_READ))
+    {
+        return false;
+    }
+
+    const software_timer_trace_header_t * header = trace->header;
+
+    if(SOFTWARE_TIMER_TRACE_MAGIC != __atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) ||
+       sizeof(software_timer_trace_record_t) != header->record_size ||
+       trace->size < sizeof(software_timer_trace_header_t) + (size_t)header->capacity * sizeof(software_timer_trace_record_t))
+    {
+        software_timer_trace_close(trace);
+        errno = EINVAL;
+        return false;
+    }
+
+    return true;
+}
+
+bool software_timer_trace_record (software_timer_trace_t * trace, uint32_t timer_id, uint64_t deadline_ticks, uint64_t fire_ticks)
+{
+    uint64_t index = __atomic_fetch_add(&trace->header->cursor, 1, __ATOMIC_RELAXED);
+
+    if(index >= trace->header->capacity)
+    {
+        return false;
+    }
+
+    software_timer_trace_record_t * record = &trace->records[index];
+    record->timer_id = timer_id;
+    record->deadline_ticks = deadline_ticks;
+    record->fire_ticks = fire_ticks;
+    record->lateness_ticks = (int64_t)(fire_ticks - deadline_ticks);
+
+    __atomic_store_n(&record->sequence, (uint32_t)(index + 1), __ATOMIC_RELEASE);
+
+    return true;
+}
+
+bool software_timer_trace_record_timer (software_timer_trace_t * trace, uint32_t timer_id, const software_timer_t * timer)
+{
+    software_timer_timestamp_t now;
+    software_timer_timer_info_get_timestamp(timer->timer_info, &now);
+
+    return software_timer_trace_record(trace, timer_id, software_timer_get_deadline_ticks(timer), software_timer_get_ticks(&now));
+}
+
+
+#endif /* defined(__linux__) */
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
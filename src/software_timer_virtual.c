@@ -0,0 +1,190 @@
+//! @file
+//! @brief The software_timer_virtual source file.
+
+
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include "software_timer_virtual.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+
+const struct software_timer_virtual_sc software_timer_virtual =
+{
+    software_timer_virtual_advance,
+    software_timer_virtual_init,
+    software_timer_virtual_next_deadline,
+    software_timer_virtual_now,
+    software_timer_virtual_register,
+    software_timer_virtual_run_until,
+    software_timer_virtual_set_ticks,
+    software_timer_virtual_step,
+    software_timer_virtual_unregister,
+
+};
+
+
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+void software_timer_virtual_advance (software_timer_virtual_t * clock, uint64_t ticks)
+{
+    software_timer_virtual_set_ticks(clock, software_timer_virtual_now(clock) + ticks);
+}
+
+software_timer_timer_info_flag_t software_timer_virtual_init (software_timer_virtual_t * clock, software_timer_timer_info_t * timer_info, software_timer_t ** timers, uint32_t capacity)
+{
+    clock->counter = 0;
+    clock->overflows = 0;
+    clock->timer_info = timer_info;
+    clock->timers = timers;
+    clock->capacity = capacity;
+    clock->count = 0;
+
+    timer_info->counter = &clock->counter;
+    timer_info->overflows = &clock->overflows;
+
+    return software_timer_timer_info_init(timer_info);
+}
+
+uint64_t software_timer_virtual_next_deadline (const software_timer_virtual_t * clock)
+{
+    uint64_t next_deadline = UINT64_MAX;
+
+    for(uint32_t index = 0; index < clock->count; ++index)
+    {
+        uint64_t deadline = software_timer_get_deadline_ticks(clock->timers[index]);
+        next_deadline = (deadline < next_deadline) ? deadline : next_deadline;
+    }
+
+    return next_deadline;
+}
+
+uint64_t software_timer_virtual_now (const software_timer_virtual_t * clock)
+{
+    software_timer_timestamp_t timestamp;
+    timestamp.counter = clock->counter;
+    timestamp.overflows = clock->overflows;
+    timestamp.timer_info = clock->timer_info;
+
+    return software_timer_get_ticks(&timestamp);
+}
+
+bool software_timer_virtual_register (software_timer_virtual_t * clock, software_timer_t * timer)
+{
+    if(clock->count >= clock->capacity)
+    {
+        return false;
+    }
+
+    clock->timers[clock->count++] = timer;
+
+    return true;
+}
+
+uint64_t software_timer_virtual_run_until (software_timer_virtual_t * clock, uint64_t ticks)
+{
+    uint64_t expired = 0;
+
+    for(;;)
+    {
+        uint64_t deadline = software_timer_virtual_next_deadline(clock);
+
+        if(UINT64_MAX == deadline || deadline > ticks)
+        {
+            break;
+        }
+
+        if(deadline > software_timer_virtual_now(clock))
+        {
+            software_timer_virtual_set_ticks(clock, deadline);
+        }
+
+        uint64_t now = software_timer_virtual_now(clock);
+
+        // A handler may unregister timers, therefore the count is read in each iteration
+        for(uint32_t index = 0; index < clock->count; ++index)
+        {
+            expired += software_timer_elapsed(clock->timers[index]) ? 1 : 0;
+        }
+
+        // A timer without a duration stays due, the clock then moves on by one tick
+        if(software_timer_virtual_next_deadline(clock) <= now)
+        {
+            if(now >= ticks)
+            {
+                break;
+            }
+
+            software_timer_virtual_set_ticks(clock, now + 1);
+        }
+    }
+
+    if(ticks > software_timer_virtual_now(clock))
+    {
+        software_timer_virtual_set_ticks(clock, ticks);
+    }
+
+    return expired;
+}
+
+void software_timer_virtual_set_ticks (software_timer_virtual_t * clock, uint64_t ticks)
+{
+    software_timer_timestamp_t timestamp;
+    timestamp.timer_info = clock->timer_info;
+    software_timer_set_ticks(&timestamp, ticks);
+
+    clock->overflows = timestamp.overflows;
+    clock->counter = timestamp.counter;
+}
+
+uint64_t software_timer_virtual_step (software_timer_virtual_t * clock)
+{
+    uint64_t deadline = software_timer_virtual_next_deadline(clock);
+
+    if(UINT64_MAX != deadline && deadline > software_timer_virtual_now(clock))
+    {
+        software_timer_virtual_set_ticks(clock, deadline);
+    }
+
+    return deadline;
+}
+
+bool software_timer_virtual_unregister (software_timer_virtual_t * clock, software_timer_t * timer)
+{
+    for(uint32_t index = 0; index < clock->count; ++index)
+    {
+        if(clock->timers[index] == timer)
+        {
+            clock->timers[index] = clock->timers[--clock->count];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
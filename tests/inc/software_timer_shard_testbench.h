@@ -0,0 +1,20 @@
+#ifndef INC_SOFTWARE_TIMER_SHARD_TESTBENCH_H_
+#define INC_SOFTWARE_TIMER_SHARD_TESTBENCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern bool software_timer_shard_test(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* INC_SOFTWARE_TIMER_SHARD_TESTBENCH_H_ */
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
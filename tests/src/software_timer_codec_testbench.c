@@ -0,0 +1,198 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_codec.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+#define EVENTS (1000)
+#define INTERVAL (64)
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static uint16_t counter;
+static uint64_t overflows;
+
+static software_timer_timer_info_t sw_timer_1 =
+{
+    .counter = &counter,
+    .overflows = &overflows,
+    .capture_compare = 0xFFFF,
+    .prescaler = 0,
+    .ticks_per_second = 42500000,
+};
+
+static software_timer_codec_t codec_1;
+static uint8_t stream_1[EVENTS * 4];
+static size_t keyframes_1[(EVENTS + INTERVAL - 1) / INTERVAL];
+static uint64_t events_1[EVENTS];
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void write_events(void)
+{
+    uint32_t random = 12345;
+    uint64_t ticks = UINT64_C(123456789012);
+
+    software_timer_codec_init(&codec_1, &sw_timer_1, stream_1, sizeof(stream_1), INTERVAL, keyframes_1, sizeof(keyframes_1) / sizeof(keyframes_1[0]));
+
+    for(uint32_t index = 0; index < EVENTS; ++index)
+    {
+        random = random * 1103515245 + 12345;
+        ticks += 50 + (random >> 16) % 2000;
+        events_1[index] = ticks;
+
+        software_timer_timestamp_t timestamp = { .timer_info = &sw_timer_1 };
+        software_timer_set_ticks(&timestamp, ticks);
+        assert( software_timer_codec_write(&codec_1, &timestamp) );
+    }
+}
+
+
+void software_timer_codec_test_write_read()
+{
+    print_function_info(__func__);
+
+    software_timer_timer_info_init(&sw_timer_1);
+    write_events();
+
+    assert( EVENTS == codec_1.count );
+    assert( 16 == codec_1.keyframes_count && 0 == keyframes_1[0] );
+
+    // At least five times smaller than the timestamps themselves
+    assert( codec_1.size * 5 <= EVENTS * sizeof(software_timer_timestamp_t) );
+    assert( codec_1.size <= EVENTS * 2 + 16 * 5 );
+
+    software_timer_timestamp_t timestamp;
+
+    for(uint32_t index = 0; index < EVENTS; ++index)
+    {
+        assert( software_timer_codec_read(&codec_1, &timestamp) );
+        assert( &sw_timer_1 == timestamp.timer_info );
+        assert( events_1[index] == software_timer_get_ticks(&timestamp) );
+    }
+
+    assert( !software_timer_codec_read(&codec_1, &timestamp) );
+
+    // Timestamps out of order are stored as negative differences
+    software_timer_codec_init(&codec_1, &sw_timer_1, stream_1, sizeof(stream_1), 0, NULL, 0);
+    software_timer_timestamp_t later = { .counter = 10, .overflows = 7, .timer_info = &sw_timer_1 };
+    software_timer_timestamp_t earlier = { .counter = 65530, .overflows = 6, .timer_info = &sw_timer_1 };
+    assert( software_timer_codec_write(&codec_1, &later) );
+    assert( software_timer_codec_write(&codec_1, &earlier) );
+    assert( software_timer_codec_read(&codec_1, &timestamp) && 10 == timestamp.counter && 7 == timestamp.overflows );
+    assert( software_timer_codec_read(&codec_1, &timestamp) && 65530 == timestamp.counter && 6 == timestamp.overflows );
+    assert( 2 == codec_1.keyframes_count );
+}
+
+void software_timer_codec_test_seek()
+{
+    print_function_info(__func__);
+
+    write_events();
+
+    software_timer_timestamp_t timestamp;
+
+    assert( software_timer_codec_seek(&codec_1, 5) );
+    assert( software_timer_codec_read(&codec_1, &timestamp) );
+    assert( events_1[5 * INTERVAL] == software_timer_get_ticks(&timestamp) );
+    assert( software_timer_codec_read(&codec_1, &timestamp) );
+    assert( events_1[5 * INTERVAL + 1] == software_timer_get_ticks(&timestamp) );
+
+    assert( software_timer_codec_seek(&codec_1, 15) );
+    for(uint32_t index = 15 * INTERVAL; index < EVENTS; ++index)
+    {
+        assert( software_timer_codec_read(&codec_1, &timestamp) );
+        assert( events_1[index] == software_timer_get_ticks(&timestamp) );
+    }
+
+    assert( !software_timer_codec_seek(&codec_1, 16) );
+
+    assert( software_timer_codec_seek(&codec_1, 0) );
+    assert( software_timer_codec_read(&codec_1, &timestamp) );
+    assert( events_1[0] == software_timer_get_ticks(&timestamp) );
+}
+
+void software_timer_codec_test_open()
+{
+    print_function_info(__func__);
+
+    write_events();
+    size_t size = codec_1.size;
+
+    // A stream read from a file, the index is rebuilt
+    static size_t keyframes_2[4];
+    software_timer_codec_t codec_2;
+    software_timer_codec_init(&codec_2, &sw_timer_1, stream_1, sizeof(stream_1), INTERVAL, keyframes_2, 4);
+    assert( software_timer_codec_open(&codec_2, size) );
+    assert( EVENTS == codec_2.count && 16 == codec_2.keyframes_count );
+    assert( keyframes_1[3] == keyframes_2[3] );
+    assert( events_1[EVENTS - 1] == codec_2.write_ticks );
+
+    software_timer_timestamp_t timestamp;
+    assert( software_timer_codec_seek(&codec_2, 3) && !software_timer_codec_seek(&codec_2, 4) );
+    assert( software_timer_codec_read(&codec_2, &timestamp) );
+    assert( events_1[3 * INTERVAL] == software_timer_get_ticks(&timestamp) );
+
+    // A truncated stream is opened up to the last complete timestamp
+    assert( 0x80 & stream_1[keyframes_1[2]] );
+    assert( !software_timer_codec_open(&codec_2, keyframes_1[2] + 1) );
+    assert( 2 * INTERVAL == codec_2.count && 2 == codec_2.keyframes_count );
+    assert( keyframes_1[2] == codec_2.size );
+
+    // A full stream does not accept a timestamp partially
+    software_timer_codec_init(&codec_2, &sw_timer_1, stream_1, 6, 1, NULL, 0);
+    timestamp.counter = 0;
+    timestamp.overflows = 100;
+    assert( software_timer_codec_write(&codec_2, &timestamp) );
+    assert( 4 == codec_2.size );
+    assert( !software_timer_codec_write(&codec_2, &timestamp) );
+    assert( 4 == codec_2.size && 1 == codec_2.count );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_codec_test(void)
+{
+    software_timer_codec_test_write_read();
+    software_timer_codec_test_seek();
+    software_timer_codec_test_open();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
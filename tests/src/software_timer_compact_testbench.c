@@ -0,0 +1,219 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_compact.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static uint32_t compact_ticked_handles[8];
+static uint32_t compact_ticked_count;
+
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void compact_ticked(software_timer_compact_pool_t * pool, software_timer_compact_t * timer)
+{
+    (void)pool;
+    compact_ticked_handles[compact_ticked_count++ % 8] = timer->handle;
+}
+
+static void compact_ticked_once(software_timer_compact_pool_t * pool, software_timer_compact_t * timer)
+{
+    compact_ticked(pool, timer);
+    software_timer_compact_stop(timer);
+}
+
+
+void software_timer_compact_test_size()
+{
+    print_function_info(__func__);
+
+    assert( 16 == sizeof(software_timer_compact_t) );
+    assert( 4 * sizeof(software_timer_compact_t) <= sizeof(software_timer_t) );
+}
+
+void software_timer_compact_test_add_remove()
+{
+    print_function_info(__func__);
+
+    software_timer_compact_t timers[3];
+    software_timer_compact_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = NULL,
+        .overflows = NULL,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_compact_init(&pool, timers, 3, &sw_timer_1, NULL);
+
+    software_timer_compact_t * timer_1 = software_timer_compact_add(&pool, 11, 5);
+    software_timer_compact_t * timer_2 = software_timer_compact_add(&pool, 22, 6);
+    software_timer_compact_t * timer_3 = software_timer_compact_add(&pool, 33, 7);
+    assert( NULL != timer_1 && NULL != timer_2 && NULL != timer_3 );
+    assert( NULL == software_timer_compact_add(&pool, 44, 8) );
+    assert( 3 == pool.count );
+    assert( false == software_timer_compact_is_running(timer_1) );
+
+    // The last timer is moved to the removed one, the pointer to it refers to an unused element
+    assert( software_timer_compact_remove(&pool, timer_1) );
+    assert( 2 == pool.count );
+    assert( 33 == timers[0].handle && 7 == timers[0].period );
+    assert( 22 == timers[1].handle );
+    assert( !software_timer_compact_remove(&pool, timer_3) );
+
+    assert( software_timer_compact_remove(&pool, &timers[1]) );
+    assert( 1 == pool.count );
+    assert( 33 == timers[0].handle );
+
+    // Timers of other storage and misaligned pointers are rejected
+    software_timer_compact_t other;
+    assert( !software_timer_compact_remove(&pool, &other) );
+    assert( !software_timer_compact_remove(&pool, (software_timer_compact_t *)((char *)&timers[0] + 4)) );
+    assert( 1 == pool.count );
+
+    assert( software_timer_compact_remove(&pool, &timers[0]) );
+    assert( 0 == pool.count );
+    assert( !software_timer_compact_remove(&pool, &timers[0]) );
+    assert( 0 == pool.count );
+
+
+    uint32_t period;
+    software_timer_duration_flag_t flag;
+
+    flag = software_timer_compact_calculate_period(&sw_timer_1, 1.0, &period);
+    assert( SOFTWARE_TIMER_DURATION_FLAG_DURATION_FITS == flag );
+    assert( 42500000 == period );
+
+    flag = software_timer_compact_calculate_period(&sw_timer_1, 3600.0, &period);
+    assert( SOFTWARE_TIMER_DURATION_FLAG_GREATER_MAX == flag );
+    assert( UINT32_MAX == period );
+}
+
+void software_timer_compact_test_poll()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_compact_t timers[4];
+    software_timer_compact_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_compact_init(&pool, timers, 4, &sw_timer_1, compact_ticked);
+    compact_ticked_count = 0;
+
+    software_timer_compact_t * timer_1 = software_timer_compact_add(&pool, 1, 4);
+    software_timer_compact_t * timer_2 = software_timer_compact_add(&pool, 2, 20);
+    software_timer_compact_add(&pool, 3, 1);
+
+    counter = 6;
+    software_timer_compact_start(&pool, timer_1);
+    software_timer_compact_start(&pool, timer_2);
+    assert( 10 == timer_1->deadline );
+    assert( 26 == timer_2->deadline );
+    assert( 10 == software_timer_compact_next_deadline(&pool) );
+
+    counter = 9;
+    assert( 0 == software_timer_compact_poll(&pool) );
+
+    counter = 10;
+    assert( 1 == software_timer_compact_poll(&pool) );
+    assert( 1 == compact_ticked_count && 1 == compact_ticked_handles[0] );
+    assert( 14 == timer_1->deadline );
+
+    // 26 ticks
+    counter = 10;
+    overflows = 1;
+    assert( 2 == software_timer_compact_poll(&pool) );
+    assert( 3 == compact_ticked_count && 2 == compact_ticked_handles[2] );
+    assert( 18 == timer_1->deadline );
+    assert( 46 == timer_2->deadline );
+
+    software_timer_compact_stop(timer_1);
+    assert( 0 == software_timer_compact_poll(&pool) );
+    assert( 46 == software_timer_compact_next_deadline(&pool) );
+
+
+    // One-shot timer
+    pool.on_tick = compact_ticked_once;
+    compact_ticked_count = 0;
+
+    software_timer_compact_start(&pool, timer_1);
+    assert( 30 == timer_1->deadline );
+
+    counter = 14;
+    assert( 1 == software_timer_compact_poll(&pool) );
+    assert( false == software_timer_compact_is_running(timer_1) );
+
+    counter = 15;
+    overflows = 2;
+    assert( 1 == software_timer_compact_poll(&pool) );
+    assert( 2 == compact_ticked_handles[1] );
+    assert( false == software_timer_compact_is_running(timer_2) );
+    assert( SOFTWARE_TIMER_COMPACT_STOPPED == software_timer_compact_next_deadline(&pool) );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_compact_test(void)
+{
+    software_timer_compact_test_size();
+    software_timer_compact_test_add_remove();
+    software_timer_compact_test_poll();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,330 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_concurrent.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+#define STRESS_POLLERS (2)
+#define STRESS_CANCELLERS (2)
+#define STRESS_TIMERS (4)
+#define STRESS_ROUNDS (2000)
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+
+//! @brief A timer of the stress test and the flag that is set after it was cancelled
+typedef struct stress_timer_s
+{
+    software_timer_t timer;
+    bool cancelled;
+
+}stress_timer_t;
+
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static volatile uint16_t counter;
+static volatile uint64_t overflows;
+
+static software_timer_timer_info_t sw_timer_1 =
+{
+    .counter = &counter,
+    .overflows = &overflows,
+    .capture_compare = 999,
+    .prescaler = 0,
+    .ticks_per_second = 1000000,
+};
+
+static software_timer_concurrent_t set_1;
+static software_timer_concurrent_slot_t slots_1[3];
+
+static uint32_t ticks_1;
+static software_timer_concurrent_handle_t cancel_handle;
+
+static software_timer_concurrent_slot_t slots_2[8];
+static stress_timer_t stress_timers[STRESS_CANCELLERS][STRESS_TIMERS];
+static bool stress_stop;
+static uint32_t stress_fired;
+static uint32_t stress_violations;
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void on_tick_1(software_timer_t * object)
+{
+    (void)object;
+    ++ticks_1;
+}
+
+static void on_tick_cancel(software_timer_t * object)
+{
+    (void)object;
+    ++ticks_1;
+
+    // Another timer can be cancelled from a handler
+    assert( software_timer_concurrent_cancel(&set_1, cancel_handle) );
+}
+
+static void start_timer(software_timer_t * timer, double seconds, software_timer_handler_t on_tick)
+{
+    software_timer_init_halt(timer, &sw_timer_1);
+    timer->on_tick = on_tick;
+    software_timer_calculate_and_set_duration(timer, seconds);
+    software_timer_start(timer);
+}
+
+
+void software_timer_concurrent_test_add()
+{
+    print_function_info(__func__);
+
+    software_timer_timer_info_init(&sw_timer_1);
+    counter = 0;
+    overflows = 0;
+    ticks_1 = 0;
+
+    assert( software_timer_concurrent_init(&set_1, slots_1, 3) );
+
+    software_timer_t timer;
+    start_timer(&timer, 0.001, on_tick_1);
+
+    software_timer_concurrent_handle_t periodic = software_timer_concurrent_add(&set_1, &timer, true);
+    software_timer_concurrent_handle_t once = software_timer_concurrent_add(&set_1, &timer, false);
+    software_timer_concurrent_handle_t cancelled = software_timer_concurrent_add(&set_1, &timer, true);
+    assert( 0 == periodic && 1 == once && 2 == cancelled );
+    assert( SOFTWARE_TIMER_CONCURRENT_INVALID_HANDLE == software_timer_concurrent_add(&set_1, &timer, true) );
+
+    assert( software_timer_concurrent_cancel(&set_1, cancelled) );
+    assert( !software_timer_concurrent_cancel(&set_1, cancelled) );
+    assert( !software_timer_concurrent_is_armed(&set_1, cancelled) );
+    assert( !software_timer_concurrent_is_armed(&set_1, SOFTWARE_TIMER_CONCURRENT_INVALID_HANDLE) );
+
+    assert( 0 == software_timer_concurrent_poll(&set_1) );
+
+    // The one-shot timer is removed after it has expired
+    counter = 0;
+    overflows = 1;
+    assert( 2 == software_timer_concurrent_poll(&set_1) && 2 == ticks_1 );
+    assert( software_timer_concurrent_is_armed(&set_1, periodic) );
+    assert( !software_timer_concurrent_is_armed(&set_1, once) );
+    assert( !software_timer_concurrent_cancel(&set_1, once) );
+
+    overflows = 2;
+    assert( 1 == software_timer_concurrent_poll(&set_1) && 3 == ticks_1 );
+
+    // A reused slot gets a new generation, the old handle does not refer to it
+    software_timer_concurrent_handle_t reused = software_timer_concurrent_add(&set_1, &timer, true);
+    assert( (reused & SOFTWARE_TIMER_CONCURRENT_INDEX_MASK) == 1 || (reused & SOFTWARE_TIMER_CONCURRENT_INDEX_MASK) == 2 );
+    assert( reused != once && reused != cancelled );
+    assert( !software_timer_concurrent_cancel(&set_1, once) && !software_timer_concurrent_cancel(&set_1, cancelled) );
+    assert( software_timer_concurrent_is_armed(&set_1, reused) );
+
+    assert( software_timer_concurrent_cancel(&set_1, periodic) );
+    assert( software_timer_concurrent_cancel(&set_1, reused) );
+    assert( 0 == software_timer_concurrent_poll(&set_1) );
+}
+
+void software_timer_concurrent_test_cancel()
+{
+    print_function_info(__func__);
+
+    counter = 0;
+    overflows = 0;
+    ticks_1 = 0;
+
+    assert( software_timer_concurrent_init(&set_1, slots_1, 3) );
+
+    software_timer_t timer;
+    start_timer(&timer, 0.001, on_tick_cancel);
+    software_timer_concurrent_handle_t first = software_timer_concurrent_add(&set_1, &timer, true);
+
+    start_timer(&timer, 0.001, on_tick_1);
+    cancel_handle = software_timer_concurrent_add(&set_1, &timer, true);
+    software_timer_concurrent_handle_t third = software_timer_concurrent_add(&set_1, &timer, true);
+
+    // The handler of the first timer cancels the second one before it is polled
+    overflows = 1;
+    assert( 2 == software_timer_concurrent_poll(&set_1) && 2 == ticks_1 );
+    assert( software_timer_concurrent_is_armed(&set_1, first) );
+    assert( !software_timer_concurrent_is_armed(&set_1, cancel_handle) );
+
+    // A cancel request of another thread during the poll frees the slot without calling the handler
+    uint32_t index = third & SOFTWARE_TIMER_CONCURRENT_INDEX_MASK;
+    slots_1[index].cancelled = slots_1[index].state | SOFTWARE_TIMER_CONCURRENT_PHASE_POLLING;
+    overflows = 2;
+    assert( software_timer_concurrent_cancel(&set_1, first) );
+    assert( 0 == software_timer_concurrent_poll(&set_1) && 2 == ticks_1 );
+    assert( !software_timer_concurrent_is_armed(&set_1, third) );
+    assert( SOFTWARE_TIMER_CONCURRENT_PHASE_FREE == slots_1[index].state % 4 );
+
+    // A late request for an old generation does not affect a new timer
+    software_timer_concurrent_handle_t fourth = software_timer_concurrent_add(&set_1, &timer, true);
+    index = fourth & SOFTWARE_TIMER_CONCURRENT_INDEX_MASK;
+    slots_1[index].cancelled = SOFTWARE_TIMER_CONCURRENT_PHASE_POLLING;
+    overflows = 3;
+    assert( 1 == software_timer_concurrent_poll(&set_1) );
+    assert( software_timer_concurrent_is_armed(&set_1, fourth) );
+}
+
+#if defined(__linux__)
+
+static void on_tick_stress(software_timer_t * object)
+{
+    stress_timer_t * stress = (stress_timer_t *)object->user_data;
+
+    __atomic_fetch_add(&stress_fired, 1, __ATOMIC_RELAXED);
+
+    if(__atomic_load_n(&stress->cancelled, __ATOMIC_ACQUIRE))
+    {
+        __atomic_fetch_add(&stress_violations, 1, __ATOMIC_RELAXED);
+    }
+}
+
+static void * poller_thread(void * argument)
+{
+    (void)argument;
+
+    while(!__atomic_load_n(&stress_stop, __ATOMIC_ACQUIRE))
+    {
+        software_timer_concurrent_poll(&set_1);
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+static void * canceller_thread(void * argument)
+{
+    stress_timer_t * timers = (stress_timer_t *)argument;
+
+    for(uint32_t round = 0; round < STRESS_ROUNDS; ++round)
+    {
+        stress_timer_t * stress = &timers[round % STRESS_TIMERS];
+
+        // A timer without a duration expires at each poll, the object is reused after the cancel
+        start_timer(&stress->timer, 0, on_tick_stress);
+        stress->timer.user_data = stress;
+        __atomic_store_n(&stress->cancelled, false, __ATOMIC_RELEASE);
+
+        software_timer_concurrent_handle_t handle = software_timer_concurrent_add(&set_1, &stress->timer, true);
+
+        if(SOFTWARE_TIMER_CONCURRENT_INVALID_HANDLE == handle)
+        {
+            sched_yield();
+            continue;
+        }
+
+        sched_yield();
+
+        bool cancelled = software_timer_concurrent_cancel(&set_1, handle);
+        assert( cancelled );
+        (void)cancelled;
+
+        __atomic_store_n(&stress->cancelled, true, __ATOMIC_RELEASE);
+    }
+
+    return NULL;
+}
+
+void software_timer_concurrent_test_stress()
+{
+    print_function_info(__func__);
+
+    counter = 0;
+    overflows = 0;
+    stress_stop = false;
+    stress_fired = 0;
+    stress_violations = 0;
+
+    assert( software_timer_concurrent_init(&set_1, slots_2, 8) );
+
+    pthread_t pollers[STRESS_POLLERS];
+    pthread_t cancellers[STRESS_CANCELLERS];
+
+    for(uint32_t index = 0; index < STRESS_POLLERS; ++index)
+    {
+        assert( 0 == pthread_create(&pollers[index], NULL, poller_thread, NULL) );
+    }
+
+    for(uint32_t index = 0; index < STRESS_CANCELLERS; ++index)
+    {
+        assert( 0 == pthread_create(&cancellers[index], NULL, canceller_thread, stress_timers[index]) );
+    }
+
+    for(uint32_t index = 0; index < STRESS_CANCELLERS; ++index)
+    {
+        assert( 0 == pthread_join(cancellers[index], NULL) );
+    }
+
+    __atomic_store_n(&stress_stop, true, __ATOMIC_RELEASE);
+
+    for(uint32_t index = 0; index < STRESS_POLLERS; ++index)
+    {
+        assert( 0 == pthread_join(pollers[index], NULL) );
+    }
+
+    // No handler was called after its cancel had returned, all slots are free again
+    assert( 0 == stress_violations );
+    assert( 0 < stress_fired );
+    assert( 0 == software_timer_concurrent_poll(&set_1) );
+}
+
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_concurrent_test(void)
+{
+    software_timer_concurrent_test_add();
+    software_timer_concurrent_test_cancel();
+
+#if defined(__linux__)
+
+    software_timer_concurrent_test_stress();
+
+#endif
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,129 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_divider.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static uint32_t software_timer_divider_test_ticks[3];
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void software_timer_divider_test_on_tick(software_timer_divider_t * divider)
+{
+    ++software_timer_divider_test_ticks[*(uint32_t *)divider->user_data];
+}
+
+
+void software_timer_divider_test_tree()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t base = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+    base.duration_overflows = 1;
+    software_timer_start(&base);
+
+    software_timer_divider_t dividers[3];
+    software_timer_divider_tree_t tree;
+    uint32_t ids[3] = { 0, 1, 2 };
+
+    memset(software_timer_divider_test_ticks, 0, sizeof(software_timer_divider_test_ticks));
+
+    software_timer_divider_init(&tree, &base, dividers, 3);
+    assert( NULL == software_timer_divider_add(&tree, NULL, 0, NULL) );
+
+    software_timer_divider_t * divider_2 = software_timer_divider_add(&tree, NULL, 2, software_timer_divider_test_on_tick);
+    software_timer_divider_t * divider_6 = software_timer_divider_add(&tree, divider_2, 3, software_timer_divider_test_on_tick);
+    software_timer_divider_t * divider_5 = software_timer_divider_add(&tree, NULL, 5, software_timer_divider_test_on_tick);
+    assert( NULL == software_timer_divider_add(&tree, NULL, 5, NULL) );
+
+    divider_2->user_data = &ids[0];
+    divider_6->user_data = &ids[1];
+    divider_5->user_data = &ids[2];
+
+    assert( 0 == software_timer_divider_poll(&tree) );
+
+    uint32_t expired = 0;
+
+    for(int i = 1; i <= 30; i++)
+    {
+        overflows = (uint64_t)i;
+        expired += software_timer_divider_poll(&tree);
+        assert( 0 == software_timer_divider_poll(&tree) );
+    }
+
+    assert( 15 == software_timer_divider_test_ticks[0] );
+    assert(  5 == software_timer_divider_test_ticks[1] );
+    assert(  6 == software_timer_divider_test_ticks[2] );
+    assert( 26 == expired );
+
+    // After the reset, the phases start again
+    overflows = 31;
+    assert( 0 == software_timer_divider_poll(&tree) );
+    software_timer_divider_reset(&tree);
+    overflows = 32;
+    assert( 0 == software_timer_divider_poll(&tree) );
+    overflows = 33;
+    assert( 1 == software_timer_divider_poll(&tree) );
+    assert( true == divider_2->fired && false == divider_6->fired );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_divider_test(void)
+{
+    software_timer_divider_test_tree();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
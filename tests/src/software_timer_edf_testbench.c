@@ -0,0 +1,185 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_edf.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static uint16_t software_timer_edf_test_counter;
+static uint64_t software_timer_edf_test_overflows;
+static uint32_t software_timer_edf_test_misses;
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+//! @brief The job consumes 3 ticks
+static void software_timer_edf_test_job(software_timer_edf_job_t * job)
+{
+    (void)job;
+    software_timer_edf_test_counter = (uint16_t)(software_timer_edf_test_counter + 3);
+}
+
+static void software_timer_edf_test_on_miss(software_timer_edf_job_t * job)
+{
+    (void)job;
+    ++software_timer_edf_test_misses;
+}
+
+static void software_timer_edf_test_set_deadline(software_timer_edf_job_t * job, uint64_t ticks)
+{
+    software_timer_timestamp_t deadline = { .timer_info = job->timer.timer_info };
+    software_timer_set_ticks(&deadline, ticks);
+    software_timer_start_at(&job->timer, &deadline);
+}
+
+
+void software_timer_edf_test_order()
+{
+    print_function_info(__func__);
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &software_timer_edf_test_counter,
+        .overflows = &software_timer_edf_test_overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    uint64_t deadlines[8] = { 50, 10, 30, 70, 20, 60, 40, 5 };
+    software_timer_edf_job_t jobs[9];
+    software_timer_edf_job_t * heap[8];
+    software_timer_edf_t queue;
+
+    software_timer_edf_init(&queue, heap, 8, &sw_timer_1, NULL);
+    assert( NULL == software_timer_edf_next(&queue) );
+    assert( NULL == software_timer_edf_pop(&queue) );
+
+    for(int i = 0; i < 9; i++)
+    {
+        software_timer_edf_job_init(&jobs[i], &sw_timer_1, software_timer_edf_test_job);
+    }
+
+    for(int i = 0; i < 8; i++)
+    {
+        software_timer_edf_test_set_deadline(&jobs[i], deadlines[i]);
+        assert( true == software_timer_edf_push(&queue, &jobs[i]) );
+    }
+
+    assert( false == software_timer_edf_push(&queue, &jobs[8]) );
+    assert( &jobs[7] == software_timer_edf_next(&queue) );
+
+    assert( true == software_timer_edf_remove(&queue, &jobs[2]) );
+    assert( false == software_timer_edf_remove(&queue, &jobs[2]) );
+    assert( true == software_timer_edf_push(&queue, &jobs[8]) );
+    assert( false == software_timer_edf_push(&queue, &jobs[8]) );
+
+    // A job without deadline is queued last
+    uint64_t expected[7] = { 5, 10, 20, 40, 50, 60, 70 };
+
+    for(int i = 0; i < 7; i++)
+    {
+        software_timer_edf_job_t * job = software_timer_edf_pop(&queue);
+        assert( expected[i] == job->deadline );
+        assert( SOFTWARE_TIMER_EDF_NOT_QUEUED == job->heap_index );
+    }
+
+    assert( &jobs[8] == software_timer_edf_pop(&queue) );
+    assert( 0 == queue.count );
+}
+
+void software_timer_edf_test_dispatch()
+{
+    print_function_info(__func__);
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &software_timer_edf_test_counter,
+        .overflows = &software_timer_edf_test_overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_edf_job_t jobs[3];
+    software_timer_edf_job_t * heap[3];
+    software_timer_edf_t queue;
+
+    software_timer_edf_test_counter = 0;
+    software_timer_edf_test_overflows = 0;
+    software_timer_edf_test_misses = 0;
+
+    software_timer_edf_init(&queue, heap, 3, &sw_timer_1, software_timer_edf_test_on_miss);
+
+    uint64_t deadlines[3] = { 10, 4, 5 };
+
+    for(int i = 0; i < 3; i++)
+    {
+        software_timer_edf_job_init(&jobs[i], &sw_timer_1, software_timer_edf_test_job);
+        software_timer_edf_test_set_deadline(&jobs[i], deadlines[i]);
+        software_timer_edf_push(&queue, &jobs[i]);
+    }
+
+    // Finished at 3, 6 and 9
+    assert( &jobs[1] == software_timer_edf_dispatch(&queue) );
+    assert( false == jobs[1].missed );
+    assert( &jobs[2] == software_timer_edf_dispatch(&queue) );
+    assert( true == jobs[2].missed );
+    assert( &jobs[0] == software_timer_edf_dispatch(&queue) );
+    assert( false == jobs[0].missed );
+    assert( NULL == software_timer_edf_dispatch(&queue) );
+
+    assert( 3 == queue.runs );
+    assert( 1 == queue.misses );
+    assert( 1 == software_timer_edf_test_misses );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_edf_test(void)
+{
+    software_timer_edf_test_order();
+    software_timer_edf_test_dispatch();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,127 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_group.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+
+void software_timer_group_test_poll()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timers[SOFTWARE_TIMER_GROUP_MEMBERS + 1];
+    software_timer_group_t group;
+
+    software_timer_group_init(&group, &sw_timer_1);
+    assert( UINT64_MAX == software_timer_group_next_deadline(&group) );
+    assert( 0 == software_timer_group_poll(&group) );
+
+    for(int i = 0; i <= SOFTWARE_TIMER_GROUP_MEMBERS; i++)
+    {
+        software_timer_init_halt(&timers[i], &sw_timer_1);
+        timers[i].duration_counter = (uint16_t)(i % 8 + 1);
+    }
+
+    for(int i = 0; i < SOFTWARE_TIMER_GROUP_MEMBERS; i++)
+    {
+        assert( i == software_timer_group_add(&group, &timers[i]) );
+    }
+
+    assert( SOFTWARE_TIMER_GROUP_INVALID_INDEX == software_timer_group_add(&group, &timers[64]) );
+    assert( UINT64_MAX == software_timer_group_next_deadline(&group) );
+
+    software_timer_group_start(&group, 3);
+    software_timer_group_start(&group, 9);
+    software_timer_group_start(&group, 57);
+    assert( 2 == software_timer_group_next_deadline(&group) );
+
+    counter = 1;
+    assert( 0 == software_timer_group_poll(&group) );
+
+    // Members 9 and 57 have a duration of 2 ticks
+    counter = 2;
+    uint64_t expired = software_timer_group_poll(&group);
+    assert( ((UINT64_C(1) << 9) | (UINT64_C(1) << 57)) == expired );
+    assert( 4 == software_timer_group_next_deadline(&group) );
+    assert( 4 == software_timer_get_deadline_ticks(&timers[9]) );
+
+    counter = 4;
+    expired = software_timer_group_poll(&group);
+    assert( ((UINT64_C(1) << 3) | (UINT64_C(1) << 9) | (UINT64_C(1) << 57)) == expired );
+    assert( 6 == software_timer_group_next_deadline(&group) );
+
+    // A stopped member no longer expires, the next check recalculates the earliest deadline
+    software_timer_stop(&timers[9]);
+    software_timer_stop(&timers[57]);
+    counter = 6;
+    assert( 0 == software_timer_group_poll(&group) );
+    assert( 8 == software_timer_group_next_deadline(&group) );
+
+    software_timer_group_remove(&group, 3);
+    assert( 3 == software_timer_group_add(&group, &timers[64]) );
+    software_timer_start(&timers[64]);
+    software_timer_group_update(&group);
+    assert( 7 == software_timer_group_next_deadline(&group) );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_group_test(void)
+{
+    software_timer_group_test_poll();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
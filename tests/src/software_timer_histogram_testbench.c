@@ -0,0 +1,150 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_histogram.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static software_timer_histogram_t histogram_1;
+static software_timer_histogram_t histogram_2;
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+
+void software_timer_histogram_test_percentile()
+{
+    print_function_info(__func__);
+
+    software_timer_histogram_init(&histogram_1);
+    assert( 0 == software_timer_histogram_percentile(&histogram_1, 50) );
+
+    for(uint64_t value = 1; value <= 1000; value++)
+    {
+        software_timer_histogram_record(&histogram_1, value);
+    }
+
+    assert( 1000 == histogram_1.count );
+    assert( 1 == histogram_1.min && 1000 == histogram_1.max );
+
+    // Values below 256 are exact, above the buckets are 2 and 4 ticks wide
+    assert( 1 == software_timer_histogram_percentile(&histogram_1, 0) );
+    assert( 100 == software_timer_histogram_percentile(&histogram_1, 10) );
+    assert( 501 == software_timer_histogram_percentile(&histogram_1, 50) );
+    assert( 991 == software_timer_histogram_percentile(&histogram_1, 99) );
+    assert( 1000 == software_timer_histogram_percentile(&histogram_1, 100) );
+}
+
+void software_timer_histogram_test_precision()
+{
+    print_function_info(__func__);
+
+    uint64_t large = UINT64_C(1) << 41;
+
+    // One hour at 1 GHz
+    for(uint64_t value = 1; value <= UINT64_C(3600000000000); value = value * 3 + 1)
+    {
+        software_timer_histogram_init(&histogram_1);
+        software_timer_histogram_record(&histogram_1, value);
+        software_timer_histogram_record(&histogram_1, large);
+
+        uint64_t result = software_timer_histogram_percentile(&histogram_1, 50);
+        assert( value <= result && result <= value + value / 128 );
+    }
+
+    software_timer_histogram_init(&histogram_1);
+    software_timer_histogram_record(&histogram_1, UINT64_C(1) << SOFTWARE_TIMER_HISTOGRAM_MAX_BITS);
+    software_timer_histogram_record(&histogram_1, UINT64_MAX);
+    assert( 2 == histogram_1.saturated );
+    assert( 2 == histogram_1.counts[SOFTWARE_TIMER_HISTOGRAM_BUCKETS - 1] );
+    assert( UINT64_MAX == histogram_1.max );
+}
+
+void software_timer_histogram_test_merge()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_histogram_init(&histogram_1);
+    software_timer_histogram_init(&histogram_2);
+
+    software_timer_timestamp_t start = { .counter = 14, .overflows = 2, .timer_info = &sw_timer_1 };
+    software_timer_timestamp_t end = { .counter = 3, .overflows = 3, .timer_info = &sw_timer_1 };
+    software_timer_histogram_record_interval(&histogram_1, &start, &end);
+    software_timer_histogram_record(&histogram_1, 7);
+    software_timer_histogram_record(&histogram_2, 3);
+    software_timer_histogram_record(&histogram_2, 3000);
+
+    software_timer_histogram_merge(&histogram_1, &histogram_2);
+
+    assert( 4 == histogram_1.count );
+    assert( 3 == histogram_1.min && 3000 == histogram_1.max );
+    assert( 1 == histogram_1.counts[3] && 1 == histogram_1.counts[5] && 1 == histogram_1.counts[7] );
+    assert( 5 == software_timer_histogram_percentile(&histogram_1, 50) );
+    assert( 3000 == software_timer_histogram_percentile(&histogram_1, 100) );
+
+    // Merging an empty histogram changes nothing
+    software_timer_histogram_init(&histogram_2);
+    software_timer_histogram_merge(&histogram_1, &histogram_2);
+    assert( 4 == histogram_1.count && 3 == histogram_1.min && 3000 == histogram_1.max );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_histogram_test(void)
+{
+    software_timer_histogram_test_percentile();
+    software_timer_histogram_test_precision();
+    software_timer_histogram_test_merge();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
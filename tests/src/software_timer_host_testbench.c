@@ -0,0 +1,142 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_host.h"
+#include "software_timer_timeout.h"
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__)
+
+static software_timer_timer_info_t host_info =
+{
+    .capture_compare = 999,
+    .prescaler = 0,
+    .ticks_per_second = 1000000,
+};
+
+static software_timer_host_t host_1;
+
+static software_timer_timeout_t manager_1;
+static software_timer_timeout_entry_t entries_1[2];
+static uint32_t buckets_1[16];
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+
+void software_timer_host_test_ns_to_ticks()
+{
+    print_function_info(__func__);
+
+    assert( 0 == software_timer_host_ns_to_ticks(999, 1000000) );
+    assert( 1 == software_timer_host_ns_to_ticks(1999, 1000000) );
+    assert( 2500000 == software_timer_host_ns_to_ticks(2500000000, 1000000) );
+
+    // One year at 10 GHz does not overflow
+    uint64_t year = UINT64_C(365) * 24 * 3600;
+    assert( year * UINT64_C(10000000000) + 10 == software_timer_host_ns_to_ticks(year * 1000000000 + 1, UINT64_C(10000000000)) );
+
+    assert( software_timer_host_monotonic_ns() <= software_timer_host_monotonic_ns() );
+}
+
+void software_timer_host_test_update()
+{
+    print_function_info(__func__);
+
+    assert( 0 == software_timer_host_init(&host_1, &host_info) );
+    assert( 1000 == host_info.period );
+
+    uint64_t first = software_timer_host_update(&host_1);
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = 2000000 };
+    nanosleep(&delay, NULL);
+    uint64_t second = software_timer_host_update(&host_1);
+    assert( second >= first + 2000 );
+
+    software_timer_timestamp_t timestamp;
+    software_timer_timer_info_get_timestamp(&host_info, &timestamp);
+    assert( second == software_timer_get_ticks(&timestamp) );
+    assert( second % 1000 == timestamp.counter && second / 1000 == timestamp.overflows );
+}
+
+void software_timer_host_test_timeout()
+{
+    print_function_info(__func__);
+
+    software_timer_host_update(&host_1);
+    assert( software_timer_timeout_init(&manager_1, &host_info, entries_1, 2, buckets_1, 16, 10) );
+
+    // The clock stands still between the updates, the start of the bucket of the deadline is returned
+    assert( software_timer_timeout_reset(&manager_1, 0, 1500) );
+    uint64_t next = software_timer_timeout_next_timeout(&manager_1);
+    assert( 0 < next && next <= 1500 && next == software_timer_timeout_next_timeout(&manager_1) );
+    assert( 1 <= software_timer_timeout_wait_ms(&manager_1) && 2 >= software_timer_timeout_wait_ms(&manager_1) );
+
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = 2000000 };
+    nanosleep(&delay, NULL);
+    assert( 0 == software_timer_timeout_expire(&manager_1) );
+
+    software_timer_host_update(&host_1);
+    assert( 1 == software_timer_timeout_expire(&manager_1) );
+    assert( -1 == software_timer_timeout_wait_ms(&manager_1) );
+}
+
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_host_test(void)
+{
+#if defined(__linux__)
+
+    software_timer_host_test_ns_to_ticks();
+    software_timer_host_test_update();
+    software_timer_host_test_timeout();
+
+#endif
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
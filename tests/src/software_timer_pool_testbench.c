@@ -0,0 +1,447 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_pool.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+
+void software_timer_pool_test_alloc_free()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_t timers[3];
+    uint16_t generations[3] = { 0 };
+    software_timer_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    assert( true == software_timer_pool_init(&pool, timers, generations, 3, &sw_timer_1) );
+    assert( 0 == pool.count );
+
+    software_timer_handle_t handle_1 = software_timer_pool_alloc(&pool);
+    software_timer_handle_t handle_2 = software_timer_pool_alloc(&pool);
+    software_timer_handle_t handle_3 = software_timer_pool_alloc(&pool);
+    assert( SOFTWARE_TIMER_POOL_INVALID_HANDLE != handle_1 );
+    assert( SOFTWARE_TIMER_POOL_INVALID_HANDLE != handle_2 );
+    assert( SOFTWARE_TIMER_POOL_INVALID_HANDLE != handle_3 );
+    assert( SOFTWARE_TIMER_POOL_INVALID_HANDLE == software_timer_pool_alloc(&pool) );
+    assert( 3 == pool.count );
+
+    software_timer_t * timer_2 = software_timer_pool_get(&pool, handle_2);
+    assert( &timers[1] == timer_2 );
+    assert( &sw_timer_1 == timer_2->timer_info );
+    assert( software_timer_is_stopped(timer_2) );
+
+    timer_2->duration_counter = 4;
+    software_timer_start(timer_2);
+    assert( software_timer_is_running(timer_2) );
+
+    // Stale handle after free
+    assert( true == software_timer_pool_free(&pool, handle_2) );
+    assert( false == software_timer_pool_free(&pool, handle_2) );
+    assert( NULL == software_timer_pool_get(&pool, handle_2) );
+    assert( false == software_timer_pool_is_valid(&pool, handle_2) );
+    assert( false == software_timer_pool_is_allocated(&pool, 1) );
+    assert( software_timer_is_stopped(&timers[1]) );
+    assert( 2 == pool.count );
+
+    // The slot is reused with a new generation
+    software_timer_handle_t handle_4 = software_timer_pool_alloc(&pool);
+    assert( (handle_4 & SOFTWARE_TIMER_POOL_INDEX_MASK) == (handle_2 & SOFTWARE_TIMER_POOL_INDEX_MASK) );
+    assert( handle_4 != handle_2 );
+    assert( NULL == software_timer_pool_get(&pool, handle_2) );
+    assert( &timers[1] == software_timer_pool_get(&pool, handle_4) );
+    assert( 0 == timers[1].duration_counter );
+
+    assert( NULL == software_timer_pool_get(&pool, SOFTWARE_TIMER_POOL_INVALID_HANDLE) );
+    assert( true == software_timer_pool_is_valid(&pool, handle_1) );
+    assert( true == software_timer_pool_is_valid(&pool, handle_3) );
+
+    // Free list order
+    assert( true == software_timer_pool_free(&pool, handle_1) );
+    assert( true == software_timer_pool_free(&pool, handle_3) );
+    assert( 2 == (software_timer_pool_alloc(&pool) & SOFTWARE_TIMER_POOL_INDEX_MASK) );
+    assert( 0 == (software_timer_pool_alloc(&pool) & SOFTWARE_TIMER_POOL_INDEX_MASK) );
+
+    // Handles of a previous use stay invalid after a new initialization
+    assert( true == software_timer_pool_init(&pool, timers, generations, 3, &sw_timer_1) );
+    assert( false == software_timer_pool_is_valid(&pool, handle_4) );
+    software_timer_pool_alloc(&pool);
+    software_timer_handle_t handle_5 = software_timer_pool_alloc(&pool);
+    assert( (handle_4 & SOFTWARE_TIMER_POOL_INDEX_MASK) == (handle_5 & SOFTWARE_TIMER_POOL_INDEX_MASK) );
+    assert( handle_4 != handle_5 );
+}
+
+void software_timer_pool_test_generation_wrap()
+{
+    print_function_info(__func__);
+
+    software_timer_t timers[1];
+    uint16_t generations[1] = { 0 };
+    software_timer_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = NULL,
+        .overflows = NULL,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    assert( true == software_timer_pool_init(&pool, timers, generations, 1, &sw_timer_1) );
+    assert( false == software_timer_pool_init(&pool, timers, generations, SOFTWARE_TIMER_POOL_INDEX_MASK, &sw_timer_1) );
+    assert( true == software_timer_pool_init(&pool, timers, generations, 1, &sw_timer_1) );
+
+    software_timer_handle_t first = software_timer_pool_alloc(&pool);
+    software_timer_handle_t previous = first;
+
+    for(uint32_t i = 0; i < 70000; i++)
+    {
+        assert( true == software_timer_pool_free(&pool, previous) );
+        software_timer_handle_t handle = software_timer_pool_alloc(&pool);
+        assert( SOFTWARE_TIMER_POOL_INVALID_HANDLE != handle );
+        assert( handle != previous );
+        assert( false == software_timer_pool_is_valid(&pool, previous) );
+        assert( true == software_timer_pool_is_valid(&pool, handle) );
+        previous = handle;
+    }
+}
+
+void software_timer_pool_test_poll_slack()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_t timers[4];
+    uint16_t generations[4] = { 0 };
+    software_timer_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_pool_init(&pool, timers, generations, 4, &sw_timer_1);
+    assert( UINT64_MAX == software_timer_pool_next_deadline(&pool) );
+
+    uint16_t durations[3] = { 21, 22, 23 };
+
+    for(int i = 0; i < 3; i++)
+    {
+        software_timer_t * timer = software_timer_pool_get(&pool, software_timer_pool_alloc(&pool));
+        timer->duration_counter = durations[i];
+        software_timer_set_slack(timer, 12);
+        software_timer_start(timer);
+    }
+
+    // Without slack three wakeups at 21, 22 and 23 would be required
+    assert( 32 == software_timer_pool_next_deadline(&pool) );
+
+    counter = 4;
+    overflows = 1;
+    assert( 0 == software_timer_pool_poll(&pool) );
+
+    counter = 0;
+    overflows = 2;
+    assert( 3 == software_timer_pool_poll(&pool) );
+    assert( 0 == software_timer_pool_poll(&pool) );
+
+    // Without slack, each timer has its own deadline
+    software_timer_set_slack(&timers[0], 0);
+    software_timer_set_slack(&timers[1], 0);
+    software_timer_set_slack(&timers[2], 0);
+    assert( 42 == software_timer_pool_next_deadline(&pool) );
+}
+
+void software_timer_pool_test_poll_slack_overlap()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_t timers[2];
+    uint16_t generations[2] = { 0 };
+    software_timer_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_pool_init(&pool, timers, generations, 2, &sw_timer_1);
+
+    software_timer_t * early = software_timer_pool_get(&pool, software_timer_pool_alloc(&pool));
+    software_timer_t * late = software_timer_pool_get(&pool, software_timer_pool_alloc(&pool));
+
+    assert( false == software_timer_expire(early) );
+    assert( UINT64_MAX == software_timer_get_end_ticks(early) );
+
+    // The windows [100, 110] and [103, 113] overlap, but 112 is rounded across the boundary of 16
+    early->duration_overflows = 6;
+    early->duration_counter = 4;
+    late->duration_overflows = 6;
+    late->duration_counter = 7;
+    software_timer_set_slack(early, 10);
+    software_timer_set_slack(late, 10);
+    software_timer_start(early);
+    software_timer_start(late);
+
+    assert( 100 == software_timer_get_end_ticks(early) );
+    assert( 103 == software_timer_get_end_ticks(late) );
+    assert( 104 == software_timer_get_deadline_ticks(early) );
+    assert( 112 == software_timer_get_deadline_ticks(late) );
+    assert( 104 == software_timer_pool_next_deadline(&pool) );
+
+    counter = 3;
+    overflows = 6;
+    assert( 0 == software_timer_pool_poll(&pool) );
+
+    // Both windows have started at the wakeup, so one pass handles both timers
+    counter = 8;
+    overflows = 6;
+    assert( 2 == software_timer_pool_poll(&pool) );
+    assert( 0 == software_timer_pool_poll(&pool) );
+    assert( 200 == software_timer_get_end_ticks(early) );
+    assert( 206 == software_timer_get_end_ticks(late) );
+}
+
+void software_timer_pool_test_pause_resume()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_t timers[3];
+    uint16_t generations[3] = { 0 };
+    software_timer_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_pool_init(&pool, timers, generations, 3, &sw_timer_1);
+
+    uint16_t durations[3] = { 4, 8, 12 };
+
+    for(int i = 0; i < 3; i++)
+    {
+        software_timer_t * timer = software_timer_pool_get(&pool, software_timer_pool_alloc(&pool));
+        timer->duration_counter = durations[i];
+        software_timer_start(timer);
+    }
+
+    software_timer_stop(&timers[2]);
+
+    counter = 2;
+    assert( 2 == software_timer_pool_pause(&pool) );
+    assert( 0 == software_timer_pool_pause(&pool) );
+    assert( software_timer_is_paused(&timers[0]) );
+    assert( software_timer_is_paused(&timers[1]) );
+    assert( false == software_timer_is_paused(&timers[2]) );
+    assert( UINT64_MAX == software_timer_pool_next_deadline(&pool) );
+
+    // 50 ticks later, the remaining 2 and 6 ticks are kept
+    counter = 4;
+    overflows = 3;
+    assert( 2 == software_timer_pool_resume(&pool) );
+    assert( 0 == software_timer_pool_resume(&pool) );
+    assert( 54 == software_timer_get_deadline_ticks(&timers[0]) );
+    assert( 58 == software_timer_get_deadline_ticks(&timers[1]) );
+    assert( software_timer_is_stopped(&timers[2]) );
+}
+
+void software_timer_pool_test_resync()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_t timers[3];
+    uint16_t generations[3] = { 0 };
+    software_timer_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_pool_init(&pool, timers, generations, 3, &sw_timer_1);
+
+    uint16_t durations[2] = { 5, 8 };
+
+    for(int i = 0; i < 2; i++)
+    {
+        software_timer_t * timer = software_timer_pool_get(&pool, software_timer_pool_alloc(&pool));
+        timer->duration_counter = durations[i];
+        software_timer_start(timer);
+    }
+
+    // Sleep until 1,600,001 ticks
+    counter = 1;
+    overflows = 100000;
+    assert( 520000 == software_timer_pool_resync(&pool, SOFTWARE_TIMER_RESYNC_POLICY_SKIP) );
+    assert( 1600005 == software_timer_get_deadline_ticks(&timers[0]) );
+    assert( 1600008 == software_timer_get_deadline_ticks(&timers[1]) );
+    assert( 0 == software_timer_pool_poll(&pool) );
+    assert( 0 == software_timer_pool_resync(&pool, SOFTWARE_TIMER_RESYNC_POLICY_SKIP) );
+}
+
+void software_timer_pool_test_rescale()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_t timers[2];
+    uint16_t generations[2] = { 0 };
+    software_timer_pool_t pool;
+
+    software_timer_timer_info_t sw_timer_fast =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_t sw_timer_slow =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 16,
+        .ticks_per_second = 10625000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_fast);
+    software_timer_timer_info_init(&sw_timer_slow);
+
+    software_timer_pool_init(&pool, timers, generations, 2, &sw_timer_fast);
+
+    uint64_t durations[2] = { 100, 1000 };
+
+    for(int i = 0; i < 2; i++)
+    {
+        software_timer_t * timer = software_timer_pool_get(&pool, software_timer_pool_alloc(&pool));
+        timer->duration_overflows = durations[i] / 16;
+        timer->duration_counter = (uint16_t)(durations[i] % 16);
+        software_timer_start(timer);
+    }
+
+    // Remaining 60 and 960 ticks of the fast timer
+    counter = 8;
+    overflows = 2;
+    assert( 2 == software_timer_pool_rescale(&pool, &sw_timer_slow) );
+    assert( &sw_timer_slow == pool.timer_info );
+    assert( &sw_timer_slow == timers[0].timer_info );
+    assert( 1 == timers[0].duration_overflows && 9 == timers[0].duration_counter );
+    assert( 15 == timers[1].duration_overflows && 10 == timers[1].duration_counter );
+
+    // The hardware timer is restarted with the new prescaler
+    counter = 0;
+    overflows = 0;
+    assert( 2 == software_timer_pool_resume(&pool) );
+    assert( 15 == software_timer_get_deadline_ticks(&timers[0]) );
+    assert( 240 == software_timer_get_deadline_ticks(&timers[1]) );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_pool_test(void)
+{
+    software_timer_pool_test_alloc_free();
+    software_timer_pool_test_generation_wrap();
+    software_timer_pool_test_poll_slack();
+    software_timer_pool_test_poll_slack_overlap();
+    software_timer_pool_test_pause_resume();
+    software_timer_pool_test_resync();
+    software_timer_pool_test_rescale();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,188 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_recorder.h"
+#include "software_timer_varint.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static volatile uint16_t hardware_counter;
+static volatile uint64_t hardware_overflows;
+
+static software_timer_timer_info_t hw_timer_1 =
+{
+    .counter = &hardware_counter,
+    .overflows = &hardware_overflows,
+    .capture_compare = 999,
+    .prescaler = 0,
+    .ticks_per_second = 1000000,
+};
+
+static software_timer_timer_info_t sw_timer_1;
+static software_timer_recorder_t recorder_1;
+static uint8_t stream_1[64];
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+
+void software_timer_recorder_test_varint()
+{
+    print_function_info(__func__);
+
+    uint8_t buffer[SOFTWARE_TIMER_VARINT_MAX_BYTES];
+    uint64_t value;
+
+    assert( 1 == software_timer_varint_write(buffer, sizeof(buffer), 0) && 0x00 == buffer[0] );
+    assert( 1 == software_timer_varint_write(buffer, sizeof(buffer), 127) && 0x7F == buffer[0] );
+    assert( 2 == software_timer_varint_write(buffer, sizeof(buffer), 300) && 0xAC == buffer[0] && 0x02 == buffer[1] );
+    assert( 2 == software_timer_varint_read(buffer, 2, &value) && 300 == value );
+    assert( 0 == software_timer_varint_read(buffer, 1, &value) );
+    assert( 0 == software_timer_varint_write(buffer, 1, 300) );
+
+    assert( 10 == software_timer_varint_write(buffer, sizeof(buffer), UINT64_MAX) );
+    assert( 10 == software_timer_varint_read(buffer, sizeof(buffer), &value) && UINT64_MAX == value );
+
+    assert( 0 == software_timer_varint_zigzag_encode(0) );
+    assert( 1 == software_timer_varint_zigzag_encode(-1) );
+    assert( 2 == software_timer_varint_zigzag_encode(1) );
+    assert( UINT64_MAX == software_timer_varint_zigzag_encode(INT64_MIN) );
+    assert( INT64_MIN == software_timer_varint_zigzag_decode(UINT64_MAX) );
+    assert( INT64_MAX == software_timer_varint_zigzag_decode(software_timer_varint_zigzag_encode(INT64_MAX)) );
+    assert( -12345 == software_timer_varint_zigzag_decode(software_timer_varint_zigzag_encode(-12345)) );
+}
+
+void software_timer_recorder_test_record_replay()
+{
+    print_function_info(__func__);
+
+    // Samples of the hardware timer, the counter runs backwards once
+    static const uint16_t counters[] = { 5, 10, 999, 0, 500, 499, 20, 20 };
+    static const uint64_t overflows[] = { 0, 0, 0, 1, 1, 1, 3000000, 3000000 };
+    static const bool expired[] = { false, false, false, true, false, false, true, true };
+    const uint32_t count = sizeof(counters) / sizeof(counters[0]);
+
+    hardware_counter = 0;
+    hardware_overflows = 0;
+
+    software_timer_t timer_1;
+
+    assert( 0 == software_timer_timer_info_init(&hw_timer_1) );
+    assert( 0 == software_timer_recorder_init_record(&recorder_1, &sw_timer_1, &hw_timer_1, stream_1, sizeof(stream_1)) );
+    assert( 1000 == sw_timer_1.period && sw_timer_1.counter == &recorder_1.counter );
+
+    software_timer_init_halt(&timer_1, &sw_timer_1);
+    software_timer_calculate_and_set_duration(&timer_1, 0.001);
+    software_timer_start(&timer_1);
+
+    for(uint32_t index = 0; index < count; ++index)
+    {
+        hardware_counter = counters[index];
+        hardware_overflows = overflows[index];
+
+        assert( software_timer_recorder_sample(&recorder_1) );
+        assert( counters[index] == recorder_1.counter && overflows[index] == recorder_1.overflows );
+        assert( expired[index] == software_timer_elapsed(&timer_1) );
+    }
+
+    // One or two bytes per small difference, the large jump needs five
+    assert( count == recorder_1.samples );
+    assert( 14 == recorder_1.size );
+
+    // The sequence is reproduced several times without the hardware
+    software_timer_timer_info_t sw_timer_2 = { .capture_compare = 999, .prescaler = 0, .ticks_per_second = 1000000 };
+    software_timer_recorder_t recorder_2;
+
+    assert( 0 == software_timer_recorder_init_replay(&recorder_2, &sw_timer_2, stream_1, recorder_1.size) );
+
+    for(uint32_t run = 0; run < 3; ++run)
+    {
+        software_timer_recorder_rewind(&recorder_2);
+
+        software_timer_init_halt(&timer_1, &sw_timer_2);
+        software_timer_calculate_and_set_duration(&timer_1, 0.001);
+        software_timer_start(&timer_1);
+
+        for(uint32_t index = 0; index < count; ++index)
+        {
+            assert( software_timer_recorder_sample(&recorder_2) );
+            assert( counters[index] == recorder_2.counter && overflows[index] == recorder_2.overflows );
+            assert( expired[index] == software_timer_elapsed(&timer_1) );
+        }
+
+        assert( !software_timer_recorder_sample(&recorder_2) );
+        assert( 20 == recorder_2.counter && count == recorder_2.samples );
+    }
+}
+
+void software_timer_recorder_test_full()
+{
+    print_function_info(__func__);
+
+    hardware_counter = 0;
+    hardware_overflows = 0;
+
+    assert( 0 == software_timer_recorder_init_record(&recorder_1, &sw_timer_1, &hw_timer_1, stream_1, 3) );
+
+    hardware_counter = 100;
+    assert( software_timer_recorder_sample(&recorder_1) );
+
+    // The value is provided nevertheless, but the stream ends before it
+    hardware_overflows = 5;
+    assert( !software_timer_recorder_sample(&recorder_1) );
+    assert( 100 == recorder_1.counter && 5 == recorder_1.overflows );
+
+    hardware_counter = 101;
+    assert( !software_timer_recorder_sample(&recorder_1) );
+    assert( recorder_1.full && 2 == recorder_1.size && 1 == recorder_1.samples );
+
+    software_timer_recorder_rewind(&recorder_1);
+    assert( !recorder_1.full && 0 == recorder_1.size && 0 == recorder_1.counter && 0 == recorder_1.overflows );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_recorder_test(void)
+{
+    software_timer_recorder_test_varint();
+    software_timer_recorder_test_record_replay();
+    software_timer_recorder_test_full();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
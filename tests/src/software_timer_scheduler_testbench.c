@@ -0,0 +1,145 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_scheduler.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static uint16_t software_timer_scheduler_test_counter;
+static uint64_t software_timer_scheduler_test_overflows;
+static uint32_t software_timer_scheduler_test_overruns;
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+//! @brief The task consumes the number of ticks given by its user data
+static void software_timer_scheduler_test_task(software_timer_task_t * task)
+{
+    software_timer_scheduler_test_counter = (uint16_t)(software_timer_scheduler_test_counter + *(uint16_t *)task->user_data);
+}
+
+static void software_timer_scheduler_test_on_overrun(software_timer_task_t * task)
+{
+    (void)task;
+    ++software_timer_scheduler_test_overruns;
+}
+
+
+void software_timer_scheduler_test_dispatch()
+{
+    print_function_info(__func__);
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &software_timer_scheduler_test_counter,
+        .overflows = &software_timer_scheduler_test_overflows,
+        .capture_compare = 15,
+        .prescaler = 1,
+        .ticks_per_second = 1000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_scheduler_test_counter = 0;
+    software_timer_scheduler_test_overflows = 0;
+    software_timer_scheduler_test_overruns = 0;
+
+    uint16_t costs[3] = { 1, 1, 2 };
+    software_timer_task_t tasks[3];
+    software_timer_scheduler_t scheduler;
+
+    assert( SOFTWARE_TIMER_DURATION_FLAG_DURATION_FITS == software_timer_scheduler_task_init(&tasks[0], &sw_timer_1, 0.008, 0, 0, software_timer_scheduler_test_task) );
+    assert( SOFTWARE_TIMER_DURATION_FLAG_DURATION_FITS == software_timer_scheduler_task_init(&tasks[1], &sw_timer_1, 0.004, 0, 1, software_timer_scheduler_test_task) );
+    assert( SOFTWARE_TIMER_DURATION_FLAG_DURATION_FITS == software_timer_scheduler_task_init(&tasks[2], &sw_timer_1, 0.004, 0.001, 0, software_timer_scheduler_test_task) );
+
+    for(int i = 0; i < 3; i++)
+    {
+        tasks[i].user_data = &costs[i];
+    }
+
+    assert( 8 == tasks[0].deadline );
+    assert( 1 == tasks[2].deadline );
+
+    // Rate-monotonic order: 4 ticks with priority 0, 4 ticks with priority 1, 8 ticks
+    software_timer_scheduler_init(&scheduler, tasks, 3, &sw_timer_1, software_timer_scheduler_test_on_overrun);
+    assert( 1 == tasks[0].deadline && 0 == tasks[0].priority );
+    assert( 4 == tasks[1].deadline && 1 == tasks[1].priority );
+    assert( 8 == tasks[2].deadline );
+
+    software_timer_scheduler_start(&scheduler);
+
+    software_timer_scheduler_test_counter = 3;
+    assert( NULL == software_timer_scheduler_dispatch(&scheduler) );
+
+    // Released at 4, finished at 6 after the deadline at 5
+    software_timer_scheduler_test_counter = 4;
+    assert( &tasks[0] == software_timer_scheduler_dispatch(&scheduler) );
+    assert( 6 == software_timer_scheduler_test_counter );
+    assert( 2 == tasks[0].execution_ticks );
+    assert( true == tasks[0].overrun );
+    assert( 1 == software_timer_scheduler_test_overruns );
+
+    assert( &tasks[1] == software_timer_scheduler_dispatch(&scheduler) );
+    assert( false == tasks[1].overrun );
+    assert( NULL == software_timer_scheduler_dispatch(&scheduler) );
+
+    // All tasks are released at 8
+    software_timer_scheduler_test_counter = 8;
+    assert( &tasks[0] == software_timer_scheduler_dispatch(&scheduler) );
+    assert( &tasks[1] == software_timer_scheduler_dispatch(&scheduler) );
+    assert( &tasks[2] == software_timer_scheduler_dispatch(&scheduler) );
+    assert( 12 == software_timer_scheduler_test_counter );
+
+    assert( 2 == tasks[0].runs && 2 == tasks[0].overruns && 2 == tasks[0].wcet_ticks );
+    assert( 2 == tasks[1].runs && 0 == tasks[1].overruns && 1 == tasks[1].wcet_ticks );
+    assert( 1 == tasks[2].runs && 0 == tasks[2].overruns && 1 == tasks[2].wcet_ticks );
+    assert( 2 == software_timer_scheduler_test_overruns );
+
+    software_timer_scheduler_reset_statistics(&scheduler);
+    assert( 0 == tasks[0].runs && 0 == tasks[0].wcet_ticks && false == tasks[0].overrun );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_scheduler_test(void)
+{
+    software_timer_scheduler_test_dispatch();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,296 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_shard.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+#define STRESS_SENDERS (3)
+#define STRESS_MESSAGES (2000)
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static volatile uint16_t counter;
+static volatile uint64_t overflows;
+
+static software_timer_timer_info_t hw_timer_1 =
+{
+    .counter = &counter,
+    .overflows = &overflows,
+    .capture_compare = 999,
+    .prescaler = 0,
+    .ticks_per_second = 1000000,
+};
+
+static software_timer_shard_t shards[2];
+static software_timer_t timers[2][4];
+static uint16_t generations[2][4];
+static software_timer_shard_message_t messages[2][4];
+
+static software_timer_handle_t received_handle;
+static uint32_t received;
+static uint32_t ticks;
+
+static software_timer_t stress_timers[4];
+static uint16_t stress_generations[4];
+static software_timer_shard_message_t stress_messages[8];
+static uint32_t stress_next[STRESS_SENDERS];
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void on_receive_1(software_timer_shard_t * shard, software_timer_handle_t handle)
+{
+    (void)shard;
+    received_handle = handle;
+    ++received;
+}
+
+static void on_tick_1(software_timer_t * object)
+{
+    (void)object;
+    ++ticks;
+}
+
+static void init_shards(void)
+{
+    software_timer_timer_info_init(&hw_timer_1);
+    counter = 0;
+    overflows = 0;
+
+    for(uint32_t index = 0; index < 2; ++index)
+    {
+        assert( software_timer_shard_init(&shards[index], &hw_timer_1, timers[index], generations[index], 4, messages[index], 4) );
+        shards[index].on_receive = on_receive_1;
+    }
+
+    received = 0;
+    ticks = 0;
+}
+
+
+void software_timer_shard_test_migrate()
+{
+    print_function_info(__func__);
+
+    software_timer_shard_message_t message[3];
+    assert( !software_timer_shard_init(&shards[0], &hw_timer_1, timers[0], generations[0], 4, message, 3) );
+
+    init_shards();
+    assert( 1000 == shards[0].timer_info.period );
+    assert( &shards[1].counter == shards[1].timer_info.counter );
+
+    // A timer is started on shard 0 and moved to shard 1
+    counter = 500;
+    software_timer_shard_snapshot(&shards[0]);
+    assert( 500 == shards[0].counter && 0 == shards[1].counter );
+
+    software_timer_handle_t handle = software_timer_pool_alloc(&shards[0].pool);
+    software_timer_t * timer = software_timer_pool_get(&shards[0].pool, handle);
+    timer->on_tick = on_tick_1;
+    software_timer_calculate_and_set_duration(timer, 0.002);
+    software_timer_start(timer);
+    uint64_t deadline = software_timer_get_deadline_ticks(timer);
+    assert( 2500 == deadline );
+
+    assert( software_timer_shard_migrate(&shards[0], handle, &shards[1]) );
+    assert( 0 == shards[0].pool.count && !software_timer_pool_is_valid(&shards[0].pool, handle) );
+    assert( !software_timer_shard_migrate(&shards[0], handle, &shards[1]) );
+
+    // The destination takes it over at its next poll with the same deadline
+    counter = 499;
+    overflows = 2;
+    assert( 0 == software_timer_shard_poll(&shards[1]) );
+    assert( 1 == received && 1 == shards[1].pool.count );
+
+    timer = software_timer_pool_get(&shards[1].pool, received_handle);
+    assert( &shards[1].timer_info == timer->timer_info );
+    assert( deadline == software_timer_get_deadline_ticks(timer) );
+
+    // Without a snapshot the shard does not see the shared clock
+    counter = 500;
+    assert( !software_timer_elapsed(timer) );
+    assert( 1 == software_timer_shard_poll(&shards[1]) );
+    assert( 1 == ticks && 0 == software_timer_shard_poll(&shards[0]) );
+}
+
+void software_timer_shard_test_mailbox()
+{
+    print_function_info(__func__);
+
+    init_shards();
+
+    software_timer_t timer;
+    software_timer_init_halt(&timer, &hw_timer_1);
+    software_timer_calculate_and_set_duration(&timer, 0.001);
+
+    software_timer_handle_t handle = software_timer_pool_alloc(&shards[0].pool);
+
+    for(uint32_t index = 0; index < 4; ++index)
+    {
+        assert( software_timer_shard_send(&shards[0], &timer) );
+    }
+
+    assert( !software_timer_shard_send(&shards[0], &timer) );
+
+    // Only three timers fit into the pool, the fourth remains in the mailbox
+    assert( 3 == software_timer_shard_receive(&shards[0]) );
+    assert( 4 == shards[0].pool.count && 3 == received );
+    assert( software_timer_shard_send(&shards[0], &timer) );
+    assert( 0 == software_timer_shard_receive(&shards[0]) );
+
+    assert( software_timer_pool_free(&shards[0].pool, handle) );
+    assert( 1 == software_timer_shard_receive(&shards[0]) );
+    assert( 4 == received && 4 == shards[0].head );
+
+    // The elements of the mailbox are used again in the next round
+    assert( software_timer_pool_free(&shards[0].pool, received_handle) );
+    assert( 1 == software_timer_shard_receive(&shards[0]) );
+    assert( 5 == shards[0].head && 5 == shards[0].tail );
+
+    for(uint32_t index = 0; index < 4; ++index)
+    {
+        assert( software_timer_shard_send(&shards[0], &timer) );
+    }
+
+    assert( !software_timer_shard_send(&shards[0], &timer) );
+
+    assert( &shards[0] == software_timer_shard_current(shards, 1) );
+    software_timer_shard_t * current = software_timer_shard_current(shards, 2);
+    assert( &shards[0] == current || &shards[1] == current );
+}
+
+#if defined(__linux__)
+
+static void on_receive_stress(software_timer_shard_t * shard, software_timer_handle_t handle)
+{
+    software_timer_t * timer = software_timer_pool_get(&shard->pool, handle);
+    uintptr_t id = (uintptr_t)timer->user_data;
+
+    // The messages of each sender arrive complete and in order
+    uint32_t sender = (uint32_t)(id >> 16);
+    assert( sender < STRESS_SENDERS );
+    assert( stress_next[sender] == (id & 0xFFFF) );
+    assert( (id & 0xFFFF) == timer->duration_counter );
+    ++stress_next[sender];
+
+    assert( software_timer_pool_free(&shard->pool, handle) );
+    ++received;
+}
+
+static void * sender_thread(void * argument)
+{
+    uintptr_t sender = (uintptr_t)argument;
+
+    software_timer_t timer;
+    software_timer_init_halt(&timer, &hw_timer_1);
+
+    for(uintptr_t index = 0; index < STRESS_MESSAGES; ++index)
+    {
+        timer.user_data = (void *)((sender << 16) | index);
+        timer.duration_counter = (uint16_t)index;
+
+        // The mailbox is smaller than the number of messages, a full mailbox is retried
+        while(!software_timer_shard_send(&shards[0], &timer))
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+void software_timer_shard_test_senders()
+{
+    print_function_info(__func__);
+
+    init_shards();
+    assert( software_timer_shard_init(&shards[0], &hw_timer_1, stress_timers, stress_generations, 4, stress_messages, 8) );
+    shards[0].on_receive = on_receive_stress;
+
+    pthread_t senders[STRESS_SENDERS];
+
+    for(uintptr_t index = 0; index < STRESS_SENDERS; ++index)
+    {
+        stress_next[index] = 0;
+        assert( 0 == pthread_create(&senders[index], NULL, sender_thread, (void *)index) );
+    }
+
+    while(received < STRESS_SENDERS * STRESS_MESSAGES)
+    {
+        if(0 == software_timer_shard_receive(&shards[0]))
+        {
+            sched_yield();
+        }
+    }
+
+    for(uint32_t index = 0; index < STRESS_SENDERS; ++index)
+    {
+        assert( 0 == pthread_join(senders[index], NULL) );
+        assert( STRESS_MESSAGES == stress_next[index] );
+    }
+
+    assert( 0 == software_timer_shard_receive(&shards[0]) );
+    assert( 0 == shards[0].pool.count && shards[0].head == shards[0].tail );
+}
+
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_shard_test(void)
+{
+    software_timer_shard_test_migrate();
+    software_timer_shard_test_mailbox();
+
+#if defined(__linux__)
+
+    software_timer_shard_test_senders();
+
+#endif
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
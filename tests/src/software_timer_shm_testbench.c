@@ -0,0 +1,157 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_shm.h"
+
+#if defined(__linux__)
+#include <time.h>
+#include <unistd.h>
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__)
+
+static char name_1[64];
+
+static software_timer_timer_info_t producer_info =
+{
+    .capture_compare = 999,
+    .prescaler = 0,
+    .ticks_per_second = 1000000,
+};
+
+static software_timer_timer_info_t consumer_info;
+
+static software_timer_shm_t producer_1;
+static software_timer_shm_t consumer_1;
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+
+void software_timer_shm_test_publish()
+{
+    print_function_info(__func__);
+
+    snprintf(name_1, sizeof(name_1), "/software_timer_test_%ld", (long)getpid());
+
+    assert( !software_timer_shm_attach(&consumer_1, name_1, &consumer_info) );
+
+    assert( software_timer_shm_create(&producer_1, name_1, &producer_info) );
+    assert( 1000 == producer_info.period );
+
+    // The consumer takes over the configuration of the producer
+    assert( software_timer_shm_attach(&consumer_1, name_1, &consumer_info) );
+    assert( 999 == consumer_info.capture_compare && 1000000 == consumer_info.ticks_per_second );
+    assert( 1000 == consumer_info.period );
+
+    software_timer_t timer_1;
+    software_timer_init_halt(&timer_1, &consumer_info);
+    software_timer_calculate_and_set_duration(&timer_1, 0.005);
+    software_timer_start(&timer_1);
+
+    // The timers of the consumer see the published time after the next snapshot
+    software_timer_shm_publish(&producer_1, 4999);
+    assert( 0 == *consumer_info.counter && 0 == *consumer_info.overflows );
+    assert( &consumer_1.counter == consumer_info.counter && &consumer_1.overflows == consumer_info.overflows );
+    software_timer_shm_snapshot(&consumer_1);
+    assert( 999 == *consumer_info.counter && 4 == *consumer_info.overflows );
+    assert( !software_timer_elapsed(&timer_1) );
+
+    software_timer_shm_publish(&producer_1, 5000);
+    assert( 0 == *producer_info.counter && 5 == *producer_info.overflows );
+    assert( !software_timer_elapsed(&timer_1) );
+    software_timer_shm_snapshot(&consumer_1);
+    assert( software_timer_elapsed(&timer_1) );
+
+    software_timer_timestamp_t timestamp;
+    software_timer_shm_read(&consumer_1, &timestamp);
+    assert( 0 == timestamp.counter && 5 == timestamp.overflows && &consumer_info == timestamp.timer_info );
+    assert( 2 * 2 == consumer_1.region->sequence );
+
+    software_timer_shm_close(&consumer_1);
+    assert( NULL == consumer_1.region );
+}
+
+void software_timer_shm_test_update()
+{
+    print_function_info(__func__);
+
+    assert( software_timer_shm_attach(&consumer_1, name_1, &consumer_info) );
+
+    // The time of CLOCK_MONOTONIC is published relative to the creation
+    uint64_t first = software_timer_shm_update(&producer_1);
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = 2000000 };
+    nanosleep(&delay, NULL);
+    uint64_t second = software_timer_shm_update(&producer_1);
+    assert( second >= first + 2000 );
+
+    software_timer_timestamp_t timestamp;
+    software_timer_shm_read(&consumer_1, &timestamp);
+    assert( second == software_timer_get_ticks(&timestamp) );
+
+    // The name is removed, attached consumers keep the last time
+    software_timer_shm_close(&producer_1);
+    assert( NULL == producer_1.region );
+    software_timer_shm_read(&consumer_1, &timestamp);
+    assert( second == software_timer_get_ticks(&timestamp) );
+    software_timer_shm_close(&consumer_1);
+
+    assert( !software_timer_shm_attach(&consumer_1, name_1, &consumer_info) );
+}
+
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_shm_test(void)
+{
+#if defined(__linux__)
+
+    software_timer_shm_test_publish();
+    software_timer_shm_test_update();
+
+#endif
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,172 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_stopwatch.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+
+void software_timer_stopwatch_test_measure()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 9,
+        .prescaler = 1,
+        .ticks_per_second = 1000000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_stopwatch_site_t sites[2];
+    software_timer_stopwatch_table_t table;
+    software_timer_stopwatch_t stopwatch;
+
+    software_timer_stopwatch_init(&table, sites, 2, &sw_timer_1);
+
+    char name[] = "loop";
+    software_timer_stopwatch_site_t * site_loop = software_timer_stopwatch_site(&table, "loop");
+    software_timer_stopwatch_site_t * site_isr = software_timer_stopwatch_site(&table, "isr");
+    assert( site_loop == software_timer_stopwatch_site(&table, name) );
+    assert( NULL == software_timer_stopwatch_site(&table, "other") );
+    assert( 0 == software_timer_stopwatch_get_mean_ns(site_loop) );
+
+    // The counter of the end is smaller than the counter of the start
+    counter = 7;
+    overflows = 3;
+    software_timer_stopwatch_start(&stopwatch, site_loop);
+    counter = 2;
+    overflows = 5;
+    assert( 15 == software_timer_stopwatch_stop(&stopwatch) );
+
+    software_timer_stopwatch_start(&stopwatch, site_loop);
+    counter = 7;
+    assert( 5 == software_timer_stopwatch_stop(&stopwatch) );
+
+    software_timer_stopwatch_start(&stopwatch, site_isr);
+    assert( 0 == software_timer_stopwatch_stop(&stopwatch) );
+
+    assert( 2 == site_loop->count );
+    assert( 5 == site_loop->min );
+    assert( 15 == site_loop->max );
+    assert( 20 == site_loop->sum );
+    assert( 10000 == software_timer_stopwatch_get_mean_ns(site_loop) );
+    assert( 15000 == software_timer_stopwatch_ticks_to_ns(&sw_timer_1, site_loop->max) );
+    assert( 1 == site_isr->count && 0 == site_isr->max );
+
+    software_timer_stopwatch_reset(&table);
+    assert( 0 == site_loop->count && UINT64_MAX == site_loop->min && 0 == site_loop->sum );
+    assert( 2 == table.count );
+}
+
+void software_timer_stopwatch_test_calibrate()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 9,
+        .prescaler = 1,
+        .ticks_per_second = 1000000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_stopwatch_site_t sites[2];
+    software_timer_stopwatch_table_t table;
+    software_timer_stopwatch_t stopwatch;
+    software_timer_stopwatch_calibration_t calibration;
+    uint64_t samples[16];
+
+    software_timer_stopwatch_init(&table, sites, 2, &sw_timer_1);
+    software_timer_stopwatch_site_t * site_loop = software_timer_stopwatch_site(&table, "loop");
+
+    // The hardware timer does not run, so the timer is slower than the measurement
+    software_timer_stopwatch_calibrate(&table, samples, 16, &calibration);
+    assert( 0 == calibration.overhead_min );
+    assert( 0 == calibration.overhead_median );
+    assert( 1 == calibration.resolution_ticks );
+    assert( 1000 == calibration.resolution_ns );
+    assert( 0 == table.overhead && 0 == site_loop->overhead );
+
+    software_timer_stopwatch_calibrate(&table, samples, 0, &calibration);
+    assert( 0 == calibration.overhead_min && 1 == calibration.resolution_ticks );
+
+    // An overhead of 2 ticks is subtracted
+    table.overhead = 2;
+    site_loop->overhead = 2;
+    software_timer_stopwatch_site_t * site_isr = software_timer_stopwatch_site(&table, "isr");
+    assert( 2 == site_isr->overhead );
+
+    software_timer_timestamp_t start = { .counter = 8, .overflows = 1, .timer_info = &sw_timer_1 };
+    software_timer_timestamp_t end = { .counter = 3, .overflows = 2, .timer_info = &sw_timer_1 };
+    assert( 3 == software_timer_stopwatch_interval(&table, &start, &end) );
+    assert( 0 == software_timer_stopwatch_interval(&table, &start, &start) );
+
+    software_timer_stopwatch_start(&stopwatch, site_loop);
+    counter = 1;
+    assert( 0 == software_timer_stopwatch_stop(&stopwatch) );
+    software_timer_stopwatch_start(&stopwatch, site_loop);
+    counter = 6;
+    assert( 3 == software_timer_stopwatch_stop(&stopwatch) );
+    assert( 0 == site_loop->min && 3 == site_loop->max && 2 == site_loop->count );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_stopwatch_test(void)
+{
+    software_timer_stopwatch_test_measure();
+    software_timer_stopwatch_test_calibrate();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -141,6 +141,8 @@ void software_timer_test_get_timestamp()
         .capture_compare_inverse = 0.0
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
     timer_1.on_tick = print_timer_info;
 
@@ -188,6 +190,8 @@ void software_timer_test_set_duration_16bit()
         .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
     timer_1.on_tick = print_timer_info;
 
@@ -310,6 +314,8 @@ void software_timer_test_set_duration_4bit()
         .capture_compare_inverse = 1.0 / (15.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
     timer_1.on_tick = print_timer_info;
 
@@ -343,6 +349,8 @@ void software_timer_test_set_duration_inline()
         .capture_compare_inverse = 1.0 / (15.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
     timer_1.on_tick = print_timer_info;
 
@@ -387,6 +395,8 @@ void software_timer_test_get_time()
         .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
 
     hw_timer_1.counter = 5;
@@ -445,6 +455,8 @@ void software_timer_test_get_timespec()
         .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
 
     software_timer_calculate_and_set_duration(&timer_1,  23.529411764705882352941176470588e-9);
@@ -495,6 +507,278 @@ void software_timer_test_get_timespec()
 
 }
 
+void software_timer_test_timer_info_init()
+{
+    print_function_info(__func__);
+
+    software_timer_timer_info_flag_t flag;
+    software_timer_timestamp_t timestamp;
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 65535,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    flag = software_timer_timer_info_init(&sw_timer_1);
+    assert( SOFTWARE_TIMER_TIMER_INFO_FLAG_VALID == flag );
+    assert( 65536 == sw_timer_1.period );
+    assert( true == sw_timer_1.period_is_power_of_two );
+    assert( 65535 == sw_timer_1.period_mask );
+    assert( 16 == sw_timer_1.period_shift );
+    assert( 1.0 / 42500000.0 == sw_timer_1.seconds_per_tick );
+    assert( 1.0 / 65536.0 == sw_timer_1.capture_compare_inverse );
+
+    timestamp.timer_info = &sw_timer_1;
+    software_timer_set_ticks(&timestamp, UINT64_C(42500000));
+    assert( 32672 == timestamp.counter );
+    assert(   648 == timestamp.overflows );
+
+
+    software_timer_timer_info_t sw_timer_2 =
+    {
+        .counter = NULL,
+        .overflows = NULL,
+        .capture_compare = 999,
+        .prescaler = 1,
+        .ticks_per_second = 0,
+    };
+
+    flag = software_timer_timer_info_init(&sw_timer_2);
+    assert( ( SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_COUNTER |
+              SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_OVERFLOWS |
+              SOFTWARE_TIMER_TIMER_INFO_FLAG_NO_TICKS_PER_SECOND ) == flag );
+    assert( 1000 == sw_timer_2.period );
+    assert( false == sw_timer_2.period_is_power_of_two );
+
+    timestamp.timer_info = &sw_timer_2;
+    for(uint64_t ticks = UINT64_C(0); ticks < UINT64_C(5000); ticks += 7)
+    {
+        software_timer_set_ticks(&timestamp, ticks);
+        assert( ticks % 1000 == timestamp.counter );
+        assert( ticks / 1000 == timestamp.overflows );
+        assert( ticks == software_timer_get_ticks(&timestamp) );
+    }
+
+    software_timer_set_ticks(&timestamp, UINT64_MAX);
+    assert( UINT64_MAX % 1000 == timestamp.counter );
+    assert( UINT64_MAX / 1000 == timestamp.overflows );
+
+
+    software_timer_timer_info_t sw_timer_3 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 15,
+        .prescaler = 1,
+        .ticks_per_second = UINT64_C(8000000000),
+    };
+
+    flag = software_timer_timer_info_init(&sw_timer_3);
+    assert( SOFTWARE_TIMER_TIMER_INFO_FLAG_SLOW_NS_CONVERSION == flag );
+}
+
+void software_timer_test_get_ns()
+{
+    print_function_info(__func__);
+
+    software_timer_timestamp_t timestamp;
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = NULL,
+        .overflows = NULL,
+        .capture_compare = 65535,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+        .seconds_per_tick = 1.0 / 42500000.0,
+        .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    timestamp.timer_info = &sw_timer_1;
+
+    timestamp.counter = 0;
+    timestamp.overflows = 0;
+    assert( 0 == software_timer_get_ticks(&timestamp) );
+    assert( 0 == software_timer_get_ns(&timestamp) );
+
+    // 23.529... ns per tick
+    timestamp.counter = 1;
+    assert( 1 == software_timer_get_ticks(&timestamp) );
+    assert( 23 == software_timer_get_ns(&timestamp) );
+
+    timestamp.counter = 17;
+    assert( 400 == software_timer_get_ns(&timestamp) );
+
+    // 1 s, 42500000 ticks
+    timestamp.counter = 32672;
+    timestamp.overflows = 648;
+    assert( UINT64_C(42500000) == software_timer_get_ticks(&timestamp) );
+    assert( UINT64_C(1000000000) == software_timer_get_ns(&timestamp) );
+
+    // One tick before 1 s
+    timestamp.counter = 32671;
+    assert( UINT64_C(999999976) == software_timer_get_ns(&timestamp) );
+
+    // 100 years (3155760000 s), 134119800000000000 ticks
+    timestamp.counter = 45056;
+    timestamp.overflows = UINT64_C(2046505737304);
+    assert( UINT64_C(134119800000000000) == software_timer_get_ticks(&timestamp) );
+    assert( UINT64_C(3155760000000000000) == software_timer_get_ns(&timestamp) );
+
+    timestamp.counter = 45056 + 17;
+    assert( UINT64_C(3155760000000000400) == software_timer_get_ns(&timestamp) );
+
+    timestamp.counter = 45056 - 1;
+    assert( UINT64_C(3155759999999999976) == software_timer_get_ns(&timestamp) );
+
+
+    // 4-bit timer with a power of two as frequency
+    software_timer_timer_info_t sw_timer_2 =
+    {
+        .counter = NULL,
+        .overflows = NULL,
+        .capture_compare = 15,
+        .prescaler = 1,
+        .ticks_per_second = 32768,
+    };
+
+    software_timer_timer_info_init(&sw_timer_2);
+
+    timestamp.timer_info = &sw_timer_2;
+
+    // 30517.578125 ns per tick
+    timestamp.counter = 1;
+    timestamp.overflows = 0;
+    assert( 30517 == software_timer_get_ns(&timestamp) );
+
+    timestamp.counter = 0;
+    timestamp.overflows = 2048;
+    assert( UINT64_C(1000000000) == software_timer_get_ns(&timestamp) );
+
+    timestamp.counter = 15;
+    timestamp.overflows = 2047;
+    assert( UINT64_C(999969482) == software_timer_get_ns(&timestamp) );
+
+
+    // Frequency with 1 tick per second
+    software_timer_timer_info_t sw_timer_3 =
+    {
+        .counter = NULL,
+        .overflows = NULL,
+        .capture_compare = 65535,
+        .prescaler = 1,
+        .ticks_per_second = 1,
+    };
+
+    software_timer_timer_info_init(&sw_timer_3);
+
+    timestamp.timer_info = &sw_timer_3;
+
+    timestamp.counter = 7;
+    timestamp.overflows = 1;
+    assert( UINT64_C(65543000000000) == software_timer_get_ns(&timestamp) );
+
+
+    // Frequency above 32 bits
+    software_timer_timer_info_t sw_timer_4 =
+    {
+        .counter = NULL,
+        .overflows = NULL,
+        .capture_compare = 65535,
+        .prescaler = 1,
+        .ticks_per_second = UINT64_C(8000000000),
+    };
+
+    software_timer_timer_info_init(&sw_timer_4);
+
+    timestamp.timer_info = &sw_timer_4;
+
+    timestamp.counter = 15;
+    timestamp.overflows = 0;
+    assert( 1 == software_timer_get_ns(&timestamp) );
+
+    timestamp.counter = 16;
+    assert( 2 == software_timer_get_ns(&timestamp) );
+
+    timestamp.counter = 0;
+    timestamp.overflows = 122070;
+    timestamp.counter = 20480;
+    assert( UINT64_C(8000000000) == software_timer_get_ticks(&timestamp) );
+    assert( UINT64_C(1000000000) == software_timer_get_ns(&timestamp) );
+}
+
+void software_timer_test_get_timespec_integer()
+{
+    struct timespec timspec_value;
+
+    print_function_info(__func__);
+
+    software_timer_timestamp_t timestamp;
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 65535,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+        .seconds_per_tick = 1.0 / 42500000.0,
+        .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+
+    software_timer_calculate_and_set_duration(&timer_1,  400.0e-9);
+    hw_timer_1.counter = timer_1.duration_counter;
+    hw_timer_1.overflows = timer_1.duration_overflows;
+    software_timer_get_timestamp(&timer_1, &timestamp);
+    software_timer_get_timespec_integer(&timestamp, &timspec_value);
+    assert(   0 == timspec_value.tv_sec );
+    assert( 400 == timspec_value.tv_nsec );
+
+    // No loss in significance for the ticks calculated by the duration,
+    // compare ::software_timer_test_get_timespec()
+    software_timer_calculate_and_set_duration(&timer_1,  9876543210.1234567898);
+    hw_timer_1.counter = timer_1.duration_counter;
+    hw_timer_1.overflows = timer_1.duration_overflows;
+    software_timer_get_timestamp(&timer_1, &timestamp);
+    software_timer_get_timespec_integer(&timestamp, &timspec_value);
+    assert( 9876543210 == timspec_value.tv_sec );
+    assert(  123456752 == timspec_value.tv_nsec );
+
+    software_timer_calculate_and_set_duration(&timer_1,  9876543210.999999999999);
+    hw_timer_1.counter = timer_1.duration_counter;
+    hw_timer_1.overflows = timer_1.duration_overflows;
+    software_timer_get_timestamp(&timer_1, &timestamp);
+    software_timer_get_timespec_integer(&timestamp, &timspec_value);
+    assert( 9876543211 == timspec_value.tv_sec );
+    assert(        752 == timspec_value.tv_nsec );
+}
+
 void software_timer_test_get_timespec_max()
 {
     struct timespec timspec_value;
@@ -522,6 +806,8 @@ void software_timer_test_get_timespec_max()
         .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
 
     hw_timer_1.counter = UINT16_MAX;
@@ -593,6 +879,8 @@ void software_timer_test_sub_timestamp()
         .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
 
     software_timer_calculate_and_set_duration(&timer_1, 1000.0e-3);
@@ -650,6 +938,8 @@ void software_timer_test_init_halt()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
     timer_1.duration_counter = 4;
     timer_1.duration_overflows = 0;
@@ -692,6 +982,8 @@ void software_timer_duration0()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 0,
@@ -743,6 +1035,8 @@ void software_timer_with_null_tick_handler()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 0,
@@ -794,6 +1088,8 @@ void software_timer_test_stop()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 0,
@@ -944,6 +1240,8 @@ void software_timer_test_start()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 0,
@@ -1108,6 +1406,8 @@ void software_timer_start2()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 0,
@@ -1301,6 +1601,8 @@ void software_timer_test_match_capture_compare()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 0,
@@ -1450,6 +1752,8 @@ void software_timer_test_greater_than_capture_compare()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 0,
@@ -1624,6 +1928,8 @@ void software_timer_late_interrupt()
         .ticks_per_second = 42500000,
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 5,
@@ -1756,6 +2062,8 @@ void software_timer_slow_checking()
         .capture_compare_inverse = 1.0 / ( UINT32_C(1) + 15 )
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 5,
@@ -1852,6 +2160,8 @@ void software_timer_slow_checking_prevent_multiple_triggers()
         .capture_compare_inverse = 1.0 / ( UINT32_C(1) + 15 )
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 =
     {
         .end_counter = 5,
@@ -1926,6 +2236,479 @@ void software_timer_slow_checking_prevent_multiple_triggers()
     assert( false == ticked );
 }
 
+void software_timer_test_start_at()
+{
+    print_function_info(__func__);
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+    timer_1.duration_counter = 8;
+
+    software_timer_timestamp_t deadline = { .timer_info = &sw_timer_1 };
+    software_timer_set_ticks(&deadline, 40);
+
+    hw_timer_1.counter = 3;
+    hw_timer_1.overflows = 1;
+    software_timer_start_at(&timer_1, &deadline);
+
+    assert( 8 == timer_1.end_counter && 2 == timer_1.end_overflows );
+    assert( false == software_timer_elapsed(&timer_1) );
+
+    hw_timer_1.counter = 8;
+    hw_timer_1.overflows = 2;
+    assert( true == software_timer_elapsed(&timer_1) );
+    assert( 0 == timer_1.end_counter && 3 == timer_1.end_overflows );
+
+    // 19 ticks, the next multiple of 12 is 24
+    hw_timer_1.counter = 3;
+    hw_timer_1.overflows = 1;
+    software_timer_start_aligned(&timer_1, 12);
+    assert( 24 == software_timer_get_deadline_ticks(&timer_1) );
+
+    // On a boundary, the next boundary is used
+    hw_timer_1.counter = 8;
+    hw_timer_1.overflows = 1;
+    software_timer_start_aligned(&timer_1, 12);
+    assert( 36 == software_timer_get_deadline_ticks(&timer_1) );
+
+    software_timer_start_aligned(&timer_1, 0);
+    assert( 32 == software_timer_get_deadline_ticks(&timer_1) );
+}
+
+void software_timer_test_pause_resume()
+{
+    print_function_info(__func__);
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+    timer_1.duration_counter = 10;
+
+    assert( false == software_timer_pause(&timer_1) );
+    assert( false == software_timer_resume(&timer_1) );
+
+    // Deadline at 29 ticks, paused at 24 ticks
+    hw_timer_1.counter = 3;
+    hw_timer_1.overflows = 1;
+    software_timer_start(&timer_1);
+
+    hw_timer_1.counter = 8;
+    assert( true == software_timer_pause(&timer_1) );
+    assert( true == software_timer_is_paused(&timer_1) );
+    assert( true == software_timer_is_stopped(&timer_1) );
+    assert( false == software_timer_pause(&timer_1) );
+
+    hw_timer_1.counter = 4;
+    hw_timer_1.overflows = 100;
+    assert( false == software_timer_elapsed(&timer_1) );
+
+    assert( true == software_timer_resume(&timer_1) );
+    assert( false == software_timer_is_paused(&timer_1) );
+    assert( 9 == timer_1.end_counter && 100 == timer_1.end_overflows );
+
+    // An expired timer expires immediately after resuming
+    hw_timer_1.counter = 12;
+    assert( true == software_timer_pause(&timer_1) );
+    hw_timer_1.overflows = 200;
+    assert( true == software_timer_resume(&timer_1) );
+    assert( true == software_timer_elapsed(&timer_1) );
+
+    // Stopping discards the remaining time
+    assert( true == software_timer_pause(&timer_1) );
+    software_timer_stop(&timer_1);
+    assert( false == software_timer_is_paused(&timer_1) );
+    assert( false == software_timer_resume(&timer_1) );
+
+    // Restarting discards the remaining time, a finished one-shot timer stays stopped
+    software_timer_start(&timer_1);
+    assert( true == software_timer_pause(&timer_1) );
+    software_timer_start(&timer_1);
+    assert( false == software_timer_is_paused(&timer_1) );
+    hw_timer_1.overflows = 300;
+    assert( true == software_timer_elapsed_once(&timer_1) );
+    assert( true == software_timer_is_stopped(&timer_1) );
+    assert( false == software_timer_is_paused(&timer_1) );
+    assert( false == software_timer_resume(&timer_1) );
+
+    software_timer_timestamp_t timestamp;
+    software_timer_get_timestamp(&timer_1, &timestamp);
+
+    software_timer_start(&timer_1);
+    assert( true == software_timer_pause(&timer_1) );
+    software_timer_start_at(&timer_1, &timestamp);
+    assert( false == software_timer_is_paused(&timer_1) );
+
+    assert( true == software_timer_pause(&timer_1) );
+    software_timer_start_batch_at(&timer_1, 1, &timestamp);
+    assert( false == software_timer_is_paused(&timer_1) );
+}
+
+void software_timer_test_restart()
+{
+    print_function_info(__func__);
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+    timer_1.duration_counter = 10;
+
+    assert( false == software_timer_restart(&timer_1) );
+
+    // Deadline at 29 ticks, the restart adds the duration to the end value and not to the time
+    hw_timer_1.counter = 3;
+    hw_timer_1.overflows = 1;
+    software_timer_start(&timer_1);
+
+    hw_timer_1.overflows = 5;
+    assert( true == software_timer_restart(&timer_1) );
+    assert( 39 == software_timer_get_deadline_ticks(&timer_1) );
+    assert( true == software_timer_restart(&timer_1) );
+    assert( 49 == software_timer_get_deadline_ticks(&timer_1) );
+}
+
+void software_timer_test_resync()
+{
+    print_function_info(__func__);
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+    timer_1.duration_counter = 4;
+    timer_1.duration_overflows = 1;
+
+    assert( 0 == software_timer_resync(&timer_1, SOFTWARE_TIMER_RESYNC_POLICY_SKIP) );
+
+    // Duration of 20 ticks, deadline at 22 ticks
+    hw_timer_1.counter = 2;
+    software_timer_start(&timer_1);
+    assert( 0 == software_timer_resync(&timer_1, SOFTWARE_TIMER_RESYNC_POLICY_SKIP) );
+
+    // Jump to 1,000,003 ticks, the expiries at 22, 42, ..., 999,982 and 1,000,002 are missed
+    hw_timer_1.counter = 3;
+    hw_timer_1.overflows = 62500;
+    assert( 50000 == software_timer_resync(&timer_1, SOFTWARE_TIMER_RESYNC_POLICY_REPORT) );
+    assert( 22 == software_timer_get_deadline_ticks(&timer_1) );
+
+    assert( 50000 == software_timer_resync(&timer_1, SOFTWARE_TIMER_RESYNC_POLICY_FIRE_ONCE) );
+    assert( 1000002 == software_timer_get_deadline_ticks(&timer_1) );
+    assert( true == software_timer_elapsed(&timer_1) );
+    assert( false == software_timer_elapsed(&timer_1) );
+    assert( 1000022 == software_timer_get_deadline_ticks(&timer_1) );
+
+    hw_timer_1.counter = 2;
+    hw_timer_1.overflows = 62510;
+    assert( 8 == software_timer_resync(&timer_1, SOFTWARE_TIMER_RESYNC_POLICY_SKIP) );
+    assert( 1000182 == software_timer_get_deadline_ticks(&timer_1) );
+    assert( false == software_timer_elapsed(&timer_1) );
+
+    hw_timer_1.counter = 3;
+    hw_timer_1.overflows = 62512;
+    assert( 1 == software_timer_resync(&timer_1, SOFTWARE_TIMER_RESYNC_POLICY_SKIP) );
+    assert( 1000202 == software_timer_get_deadline_ticks(&timer_1) );
+}
+
+void software_timer_test_convert_ticks()
+{
+    print_function_info(__func__);
+
+    uint16_t counter = 0;
+    uint64_t overflows = 0;
+
+    software_timer_timer_info_t sw_timer_fast =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_t sw_timer_slow =
+    {
+        .counter = &counter,
+        .overflows = &overflows,
+        .capture_compare = UINT16_MAX,
+        .prescaler = 16,
+        .ticks_per_second = 10625000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_fast);
+    software_timer_timer_info_init(&sw_timer_slow);
+
+    assert( 250 == software_timer_convert_ticks(1000, &sw_timer_fast, &sw_timer_slow) );
+    assert( 251 == software_timer_convert_ticks(1001, &sw_timer_fast, &sw_timer_slow) );
+    assert( 4000 == software_timer_convert_ticks(1000, &sw_timer_slow, &sw_timer_fast) );
+    assert( 1001 == software_timer_convert_ticks(1001, &sw_timer_fast, &sw_timer_fast) );
+
+    // 100 years, the product exceeds 64 bits
+    assert( UINT64_C(33507000000000000) == software_timer_convert_ticks(UINT64_C(134028000000000000), &sw_timer_fast, &sw_timer_slow) );
+
+    software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_fast);
+    timer_1.duration_overflows = 62;
+    timer_1.duration_counter = 8;
+
+    software_timer_start(&timer_1);
+    assert( false == software_timer_rescale(&timer_1, &sw_timer_slow) );
+
+    // 996 remaining ticks
+    counter = 4;
+    assert( true == software_timer_pause(&timer_1) );
+    assert( true == software_timer_rescale(&timer_1, &sw_timer_slow) );
+    assert( &sw_timer_slow == timer_1.timer_info );
+    assert( 0 == timer_1.duration_overflows && 250 == timer_1.duration_counter );
+
+    counter = 0;
+    overflows = 0;
+    assert( true == software_timer_resume(&timer_1) );
+    assert( 249 == software_timer_get_deadline_ticks(&timer_1) );
+
+    // The quotient of the conversion exceeds 64 bits
+    assert( UINT64_MAX == software_timer_convert_ticks(UINT64_MAX / 2, &sw_timer_slow, &sw_timer_fast) );
+    assert( UINT64_MAX == software_timer_convert_ticks(UINT64_MAX / 4 + 1, &sw_timer_slow, &sw_timer_fast) );
+    assert( UINT64_MAX - 3 == software_timer_convert_ticks(UINT64_MAX / 4, &sw_timer_slow, &sw_timer_fast) );
+
+    // A long duration of the slow timer does not fit into the ticks of the fast timer
+    software_timer_t timer_2 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_slow);
+    timer_2.duration_overflows = UINT64_MAX / 65536 / 2;
+    timer_2.duration_counter = 0;
+    assert( false == software_timer_rescale(&timer_2, &sw_timer_fast) );
+    assert( &sw_timer_slow == timer_2.timer_info );
+    assert( UINT64_MAX / 65536 / 2 == timer_2.duration_overflows && 0 == timer_2.duration_counter );
+
+    // The duration itself exceeds 64 bits of ticks
+    timer_2.duration_overflows = UINT64_MAX / 65536 + 1;
+    assert( false == software_timer_rescale(&timer_2, &sw_timer_slow) );
+
+    // Also the remaining time of a paused timer is checked
+    timer_2.duration_overflows = 0;
+    timer_2.end_overflows = UINT64_MAX;
+    timer_2.paused_ticks = UINT64_MAX / 2;
+    assert( true == software_timer_is_paused(&timer_2) );
+    assert( false == software_timer_rescale(&timer_2, &sw_timer_fast) );
+    assert( UINT64_MAX / 2 == timer_2.paused_ticks );
+
+    timer_2.paused_ticks = 1001;
+    assert( true == software_timer_rescale(&timer_2, &sw_timer_fast) );
+    assert( 4001 == timer_2.paused_ticks );
+}
+
+void software_timer_test_start_batch()
+{
+    print_function_info(__func__);
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timers[3] =
+    {
+        SOFTWARE_TIMER_INIT_HALT(&sw_timer_1),
+        SOFTWARE_TIMER_INIT_HALT(&sw_timer_1),
+        SOFTWARE_TIMER_INIT_HALT(&sw_timer_1),
+    };
+
+    timers[0].duration_counter = 4;
+    timers[1].duration_counter = 10;
+    timers[2].duration_counter = 3;
+    timers[2].duration_overflows = 2;
+
+    hw_timer_1.counter = 9;
+    hw_timer_1.overflows = 1;
+    software_timer_start_batch(timers, 3);
+
+    assert( 13 == timers[0].end_counter && 1 == timers[0].end_overflows );
+    assert(  3 == timers[1].end_counter && 2 == timers[1].end_overflows );
+    assert( 12 == timers[2].end_counter && 3 == timers[2].end_overflows );
+
+    software_timer_timestamp_t timestamp =
+    {
+        .counter = 15,
+        .overflows = 4,
+        .timer_info = &sw_timer_1,
+    };
+
+    software_timer_start_batch_at(timers, 2, &timestamp);
+
+    assert(  3 == timers[0].end_counter && 5 == timers[0].end_overflows );
+    assert(  9 == timers[1].end_counter && 5 == timers[1].end_overflows );
+    assert( 12 == timers[2].end_counter && 3 == timers[2].end_overflows );
+
+    software_timer_start_batch(timers, 0);
+    assert(  3 == timers[0].end_counter && 5 == timers[0].end_overflows );
+}
+
+void software_timer_test_slack()
+{
+    print_function_info(__func__);
+
+    hardware_timer_t hw_timer_1 =
+    {
+        .counter = 0,
+        .capture_compare = 0x0F,
+        .overflows = 0,
+        .overflow_event = NULL,
+    };
+
+    software_timer_timer_info_t sw_timer_1 =
+    {
+        .counter = &hw_timer_1.counter,
+        .overflows = &hw_timer_1.overflows,
+        .capture_compare = 15,
+        .prescaler = 4,
+        .ticks_per_second = 42500000,
+    };
+
+    software_timer_timer_info_init(&sw_timer_1);
+
+    software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+    software_timer_t timer_2 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
+    timer_1.duration_counter = 5;
+    timer_2.duration_counter = 6;
+
+    assert( 0 == timer_1.slack );
+    assert( UINT64_MAX == software_timer_get_deadline_ticks(&timer_1) );
+
+    software_timer_start(&timer_1);
+    software_timer_start(&timer_2);
+    assert( 5 == software_timer_get_deadline_ticks(&timer_1) );
+    assert( 6 == software_timer_get_deadline_ticks(&timer_2) );
+
+    // The windows [5, 8] and [6, 9] share the deadline 8
+    software_timer_set_slack(&timer_1, 3);
+    software_timer_set_slack(&timer_2, 3);
+    assert( 8 == software_timer_get_deadline_ticks(&timer_1) );
+    assert( 8 == software_timer_get_deadline_ticks(&timer_2) );
+
+    bool ticked_1;
+    bool ticked_2;
+
+    for(uint16_t counter = 0; counter < 8; counter++)
+    {
+        assert( counter == hw_timer_1.counter );
+        ticked_1 = software_timer_elapsed(&timer_1);
+        ticked_2 = software_timer_elapsed_once(&timer_2);
+        assert( false == ticked_1 && false == ticked_2 );
+
+        hardware_timer_increment(&hw_timer_1);
+    }
+
+    ticked_1 = software_timer_elapsed(&timer_1);
+    ticked_2 = software_timer_elapsed_once(&timer_2);
+    assert( true == ticked_1 && true == ticked_2 );
+
+    // The interval is retained: nominal 10 within [10, 13] becomes 12, nominal 15 within [15, 18] becomes 16
+    assert( 10 == timer_1.end_counter );
+    assert( 12 == software_timer_get_deadline_ticks(&timer_1) );
+
+    for(uint16_t counter = 9; counter < 12; counter++)
+    {
+        hardware_timer_increment(&hw_timer_1);
+        assert( false == software_timer_elapsed(&timer_1) );
+    }
+
+    hardware_timer_increment(&hw_timer_1);
+    assert( true == software_timer_elapsed(&timer_1) );
+    assert( 16 == software_timer_get_deadline_ticks(&timer_1) );
+
+    for(uint16_t counter = 13; counter < 16; counter++)
+    {
+        hardware_timer_increment(&hw_timer_1);
+        assert( false == software_timer_elapsed_prevent_multiple_triggers(&timer_1) );
+    }
+
+    hardware_timer_increment(&hw_timer_1);
+    assert( 0 == hw_timer_1.counter && 1 == hw_timer_1.overflows );
+    assert( true == software_timer_elapsed_prevent_multiple_triggers(&timer_1) );
+
+    software_timer_stop(&timer_1);
+    assert( UINT64_MAX == software_timer_get_deadline_ticks(&timer_1) );
+    assert( false == software_timer_elapsed(&timer_1) );
+}
+
 void software_timer_max_seconds()
 {
     print_function_info(__func__);
@@ -1949,6 +2732,8 @@ void software_timer_max_seconds()
         .capture_compare_inverse = 1.0 / (65535.0 + 1.0),
     };
 
+    software_timer_timer_info_init(&sw_timer_1);
+
     software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&sw_timer_1);
 
     double max_sec = SOFTWARE_TIMER_MAX_SECONDS(&sw_timer_1);
@@ -2036,6 +2821,8 @@ software_timer_t timer_1 = SOFTWARE_TIMER_INIT_HALT(&timer_info_1);
 
 void software_timer_run_example_1()
 {
+    software_timer.TimerInfoInit(&timer_info_1);
+
     double timer_in_seconds = 1.5e-3;
     software_timer.CalculateAndSetDuration(&timer_1, timer_in_seconds);
 
@@ -2134,6 +2921,9 @@ bool software_timer_test(void)
     software_timer_test_sub_timestamp();
     software_timer_test_get_time();
     software_timer_test_get_timespec();
+    software_timer_test_timer_info_init();
+    software_timer_test_get_ns();
+    software_timer_test_get_timespec_integer();
 #if false
     software_timer_test_get_timespec_max();
 #endif
@@ -2150,6 +2940,13 @@ bool software_timer_test(void)
     software_timer_slow_checking();
     software_timer_slow_checking_prevent_multiple_triggers();
     software_timer_max_seconds();
+    software_timer_test_slack();
+    software_timer_test_start_batch();
+    software_timer_test_start_at();
+    software_timer_test_pause_resume();
+    software_timer_test_restart();
+    software_timer_test_resync();
+    software_timer_test_convert_ticks();
 
     software_timer_run_example_1();
 
@@ -0,0 +1,300 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <limits.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_timeout.h"
+#include "software_timer_virtual.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static software_timer_virtual_t clock_1;
+
+static software_timer_timer_info_t sw_timer_1 =
+{
+    .capture_compare = 0xFFFF,
+    .prescaler = 0,
+    .ticks_per_second = 1000000,
+};
+
+static software_timer_timeout_t manager_1;
+static software_timer_timeout_entry_t entries_1[4];
+static uint32_t buckets_1[8];
+
+static uint32_t fired_1[8];
+static uint32_t fired_count_1;
+static bool close_on_timeout_1;
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void on_timeout_1(software_timer_timeout_t * manager, uint32_t index)
+{
+    fired_1[fired_count_1++] = index;
+
+    // The first connection closes the third one and makes the fourth one expire immediately
+    if(close_on_timeout_1 && 1 == index)
+    {
+        assert( software_timer_timeout_cancel(manager, 2) );
+        assert( software_timer_timeout_reset(manager, 3, 0) );
+    }
+}
+
+static void setup(void)
+{
+    assert( 0 == software_timer_virtual_init(&clock_1, &sw_timer_1, NULL, 0) );
+
+    // 1024 ticks per bucket, the wheel covers 8192 ticks
+    assert( !software_timer_timeout_init(&manager_1, &sw_timer_1, entries_1, 4, buckets_1, 6, 10) );
+    assert( software_timer_timeout_init(&manager_1, &sw_timer_1, entries_1, 4, buckets_1, 8, 10) );
+
+    manager_1.on_timeout = on_timeout_1;
+    fired_count_1 = 0;
+    close_on_timeout_1 = false;
+}
+
+
+void software_timer_timeout_test_reset()
+{
+    print_function_info(__func__);
+
+    setup();
+
+    assert( UINT64_MAX == software_timer_timeout_next_timeout(&manager_1) );
+    assert( -1 == software_timer_timeout_wait_ms(&manager_1) );
+    assert( !software_timer_timeout_is_active(&manager_1, 0) );
+
+    assert( software_timer_timeout_reset(&manager_1, 0, 3000) );
+    assert( software_timer_timeout_is_active(&manager_1, 0) );
+    assert( 2 == entries_1[0].scheduled && 0 == buckets_1[2] );
+
+    // A later deadline is only stored
+    assert( software_timer_timeout_reset(&manager_1, 0, 5000) );
+    assert( 5000 == entries_1[0].deadline && 2 == entries_1[0].scheduled && 0 == buckets_1[2] );
+    assert( 2048 == software_timer_timeout_next_timeout(&manager_1) );
+
+    // An earlier deadline moves the entry
+    assert( software_timer_timeout_reset(&manager_1, 0, 1500) );
+    assert( 1 == entries_1[0].scheduled && 0 == buckets_1[1] && SOFTWARE_TIMER_TIMEOUT_NONE == buckets_1[2] );
+    assert( 1 == manager_1.count );
+
+    // The start of the bucket is returned, the wait is rounded up to whole milliseconds
+    assert( 1024 == software_timer_timeout_next_timeout(&manager_1) );
+    assert( 2 == software_timer_timeout_wait_ms(&manager_1) );
+
+    assert( !software_timer_timeout_reset(&manager_1, 4, 1000) );
+    assert( !software_timer_timeout_cancel(&manager_1, 1) );
+    assert( software_timer_timeout_cancel(&manager_1, 0) );
+    assert( !software_timer_timeout_cancel(&manager_1, 0) );
+    assert( 0 == manager_1.count && SOFTWARE_TIMER_TIMEOUT_NONE == buckets_1[1] );
+}
+
+void software_timer_timeout_test_expire()
+{
+    print_function_info(__func__);
+
+    setup();
+    close_on_timeout_1 = true;
+
+    assert( software_timer_timeout_reset(&manager_1, 0, 1500) );
+    assert( software_timer_timeout_reset(&manager_1, 0, 5000) );
+    assert( software_timer_timeout_reset(&manager_1, 1, 2000) );
+    assert( software_timer_timeout_reset(&manager_1, 2, 2500) );
+    assert( software_timer_timeout_reset(&manager_1, 3, 9000) );
+    assert( 4 == manager_1.count );
+
+    // The deadline of the fourth entry lies one round ahead in the first bucket
+    assert( 8 == entries_1[3].scheduled && 3 == buckets_1[0] );
+    assert( 1024 == software_timer_timeout_next_timeout(&manager_1) );
+
+    // The lazily reset entry moves to the bucket of its deadline
+    software_timer_virtual_set_ticks(&clock_1, 1999);
+    assert( 0 == software_timer_timeout_expire(&manager_1) );
+    assert( 4 == entries_1[0].scheduled && 0 == buckets_1[4] );
+    assert( 8 == entries_1[3].scheduled && 3 == buckets_1[0] );
+    assert( 1 == software_timer_timeout_next_timeout(&manager_1) );
+    assert( 1 == software_timer_timeout_wait_ms(&manager_1) );
+
+    software_timer_virtual_set_ticks(&clock_1, 2000);
+    assert( 1 == software_timer_timeout_expire(&manager_1) );
+    assert( 1 == fired_count_1 && 1 == fired_1[0] );
+    assert( !software_timer_timeout_is_active(&manager_1, 1) );
+    assert( !software_timer_timeout_is_active(&manager_1, 2) );
+
+    // The entry reset by the handler expires with the next call
+    assert( 0 == software_timer_timeout_next_timeout(&manager_1) );
+    assert( 0 == software_timer_timeout_wait_ms(&manager_1) );
+    assert( 1 == software_timer_timeout_expire(&manager_1) );
+    assert( 2 == fired_count_1 && 3 == fired_1[1] );
+
+    assert( 2096 == software_timer_timeout_next_timeout(&manager_1) );
+    software_timer_virtual_set_ticks(&clock_1, 5000);
+    assert( 1 == software_timer_timeout_expire(&manager_1) );
+    assert( 3 == fired_count_1 && 0 == fired_1[2] );
+
+    assert( 0 == manager_1.count );
+    assert( UINT64_MAX == software_timer_timeout_next_timeout(&manager_1) );
+    assert( 0 == software_timer_timeout_expire(&manager_1) );
+}
+
+void software_timer_timeout_test_wraparound()
+{
+    print_function_info(__func__);
+
+    setup();
+
+    // The deadline lies 12 rounds ahead, the entry is passed over until then
+    assert( software_timer_timeout_reset(&manager_1, 0, 100000) );
+
+    for(uint64_t ticks = 1000; ticks < 100000; ticks += 1000)
+    {
+        software_timer_virtual_set_ticks(&clock_1, ticks);
+        assert( 0 == software_timer_timeout_expire(&manager_1) );
+
+        // Exact in the bucket of the entry, otherwise the start of the next visit of it
+        uint64_t next = software_timer_timeout_next_timeout(&manager_1);
+        assert( 0 < next && next <= 100000 - ticks );
+        assert( (100000 - ticks == next) || (0 == ((ticks + next) & 1023) && 1 == (((ticks + next) >> 10) & 7)) );
+    }
+
+    software_timer_virtual_set_ticks(&clock_1, 100000);
+    assert( 1 == software_timer_timeout_expire(&manager_1) );
+    assert( 1 == fired_count_1 && 0 == fired_1[0] );
+
+    // After a long pause each bucket is processed only once
+    assert( software_timer_timeout_reset(&manager_1, 0, 50000) );
+    assert( software_timer_timeout_reset(&manager_1, 1, 60000) );
+    software_timer_virtual_set_ticks(&clock_1, 1000000);
+    assert( 2 == software_timer_timeout_expire(&manager_1) );
+    assert( 3 == fired_count_1 );
+    assert( (1000000 >> 10) == manager_1.current );
+
+    assert( software_timer_timeout_reset(&manager_1, 2, 1024) );
+    assert( (977 << 10) - 1000000 == software_timer_timeout_next_timeout(&manager_1) );
+}
+
+void software_timer_timeout_test_never()
+{
+    print_function_info(__func__);
+
+    setup();
+    assert( software_timer_timeout_init(&manager_1, &sw_timer_1, entries_1, 4, buckets_1, 8, 0) );
+
+    // The longest timeout is clamped, it stays in the wheel and is counted once
+    assert( software_timer_timeout_reset(&manager_1, 0, UINT64_MAX) );
+    assert( software_timer_timeout_is_active(&manager_1, 0) );
+    assert( software_timer_timeout_reset(&manager_1, 0, UINT64_MAX) );
+    assert( 1 == manager_1.count );
+    assert( UINT64_MAX - 2 == entries_1[0].deadline );
+
+    // The entry is visited every round of the wheel, at the start of its bucket
+    assert( 5 == software_timer_timeout_next_timeout(&manager_1) );
+    assert( 1 == software_timer_timeout_wait_ms(&manager_1) );
+
+    software_timer_virtual_set_ticks(&clock_1, 1000);
+    assert( 0 == software_timer_timeout_expire(&manager_1) );
+    assert( software_timer_timeout_reset(&manager_1, 1, UINT64_MAX) );
+    assert( 2 == manager_1.count );
+    assert( 0 == software_timer_timeout_expire(&manager_1) );
+    assert( 5 == software_timer_timeout_next_timeout(&manager_1) );
+
+    assert( software_timer_timeout_cancel(&manager_1, 0) );
+    assert( software_timer_timeout_cancel(&manager_1, 1) );
+    assert( 0 == manager_1.count && -1 == software_timer_timeout_wait_ms(&manager_1) );
+}
+
+void software_timer_timeout_test_many_lazy()
+{
+    print_function_info(__func__);
+
+    static software_timer_timeout_entry_t entries[256];
+    static uint32_t buckets[8];
+    software_timer_timeout_t manager;
+
+    setup();
+    assert( software_timer_timeout_init(&manager, &sw_timer_1, entries, 256, buckets, 8, 10) );
+
+    for(uint32_t index = 0; index < 256; ++index)
+    {
+        assert( software_timer_timeout_reset(&manager, index, 1500) );
+    }
+
+    // All entries are reset lazily and stay in the second bucket
+    for(uint64_t round = 0; round < 10; ++round)
+    {
+        for(uint32_t index = 0; index < 256; ++index)
+        {
+            assert( software_timer_timeout_reset(&manager, index, 2000 + round) );
+        }
+    }
+
+    assert( 1 == entries[0].scheduled && 1 == entries[255].scheduled && 2009 == entries[255].deadline );
+    assert( 1024 == software_timer_timeout_next_timeout(&manager) );
+
+    // The wakeup is early, the entries stay in the current bucket with their exact deadline
+    software_timer_virtual_set_ticks(&clock_1, 1024);
+    assert( 0 == software_timer_timeout_expire(&manager) );
+    assert( 1 == manager.current );
+    assert( 985 == software_timer_timeout_next_timeout(&manager) );
+
+    // A reset moves the entries out of the current bucket, so it stays exact
+    for(uint32_t index = 0; index < 256; ++index)
+    {
+        assert( software_timer_timeout_reset(&manager, index, 5000) );
+    }
+
+    assert( 5 == entries[0].scheduled && SOFTWARE_TIMER_TIMEOUT_NONE == buckets[1] );
+    assert( 4096 == software_timer_timeout_next_timeout(&manager) );
+
+    software_timer_virtual_set_ticks(&clock_1, 6024);
+    assert( 256 == software_timer_timeout_expire(&manager) );
+    assert( UINT64_MAX == software_timer_timeout_next_timeout(&manager) );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_timeout_test(void)
+{
+    software_timer_timeout_test_reset();
+    software_timer_timeout_test_expire();
+    software_timer_timeout_test_wraparound();
+    software_timer_timeout_test_never();
+    software_timer_timeout_test_many_lazy();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
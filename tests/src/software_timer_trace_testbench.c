@@ -0,0 +1,278 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_trace.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+
+#define TRACE_PATH "/tmp/software_timer_trace_test.bin"
+
+#define STRESS_WRITERS (4)
+#define STRESS_RECORDS (1000)
+#define STRESS_EXTRA (25)
+
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__)
+
+//! @brief A writer thread of the stress test
+typedef struct stress_writer_s
+{
+    pthread_t thread;
+    uint32_t timer_id;
+    uint32_t written;
+
+}stress_writer_t;
+
+#endif
+
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+#if defined(__linux__)
+
+static volatile uint16_t counter;
+static volatile uint64_t overflows;
+
+static software_timer_timer_info_t sw_timer_1 =
+{
+    .counter = &counter,
+    .overflows = &overflows,
+    .capture_compare = 0xFFFF,
+    .prescaler = 0,
+    .ticks_per_second = 42500000,
+};
+
+static software_timer_trace_t writer_1;
+static software_timer_trace_t reader_1;
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void on_tick_1(software_timer_t * object)
+{
+    software_timer_trace_record_timer(&writer_1, 7, object);
+}
+
+
+void software_timer_trace_test_record()
+{
+    print_function_info(__func__);
+
+    software_timer_timer_info_init(&sw_timer_1);
+    counter = 0;
+    overflows = 0;
+
+    assert( software_timer_trace_create(&writer_1, TRACE_PATH, 4, &sw_timer_1) );
+    assert( software_timer_trace_open(&reader_1, TRACE_PATH) );
+    assert( 4 == reader_1.header->capacity && 42500000 == reader_1.header->ticks_per_second );
+
+    software_timer_trace_record_t record;
+    assert( !software_timer_trace_next(&reader_1, &record) );
+
+    // The handler records the deadline that has just expired
+    software_timer_t timer_1;
+    software_timer_init_halt(&timer_1, &sw_timer_1);
+    timer_1.on_tick = on_tick_1;
+    software_timer_calculate_and_set_duration(&timer_1, 0.001);
+    software_timer_start(&timer_1);
+    uint64_t deadline = software_timer_get_deadline_ticks(&timer_1);
+
+    counter = 42;
+    overflows = 1;
+    assert( software_timer_elapsed(&timer_1) );
+
+    assert( software_timer_trace_next(&reader_1, &record) );
+    assert( 1 == record.sequence && 7 == record.timer_id );
+    assert( deadline == record.deadline_ticks && 65536 + 42 == record.fire_ticks );
+    assert( (int64_t)(65536 + 42 - deadline) == record.lateness_ticks );
+
+    assert( software_timer_trace_record(&writer_1, 1, 1000, 990) );
+    assert( software_timer_trace_next(&reader_1, &record) );
+    assert( -10 == record.lateness_ticks );
+
+    software_timer_trace_close(&writer_1);
+    software_timer_trace_close(&reader_1);
+    assert( -1 == writer_1.file && -1 == reader_1.file );
+}
+
+void software_timer_trace_test_tail()
+{
+    print_function_info(__func__);
+
+    assert( software_timer_trace_create(&writer_1, TRACE_PATH, 4, &sw_timer_1) );
+    assert( software_timer_trace_open(&reader_1, TRACE_PATH) );
+
+    software_timer_trace_record_t record;
+
+    // A reserved record that is not yet published stops the reader
+    assert( software_timer_trace_record(&writer_1, 1, 0, 1) );
+    writer_1.header->cursor++;
+    assert( software_timer_trace_record(&writer_1, 3, 0, 3) );
+
+    assert( software_timer_trace_next(&reader_1, &record) && 1 == record.timer_id );
+    assert( !software_timer_trace_next(&reader_1, &record) );
+
+    writer_1.records[1].timer_id = 2;
+    writer_1.records[1].sequence = 2;
+    assert( software_timer_trace_next(&reader_1, &record) && 2 == record.timer_id );
+    assert( software_timer_trace_next(&reader_1, &record) && 3 == record.timer_id );
+
+    // Records that do not fit are counted
+    assert( 0 == software_timer_trace_dropped(&writer_1) );
+    assert( software_timer_trace_record(&writer_1, 4, 0, 4) );
+    assert( !software_timer_trace_record(&writer_1, 5, 0, 5) );
+    assert( !software_timer_trace_record(&writer_1, 6, 0, 6) );
+    assert( 2 == software_timer_trace_dropped(&writer_1) );
+
+    assert( software_timer_trace_next(&reader_1, &record) && 4 == record.timer_id );
+    assert( !software_timer_trace_next(&reader_1, &record) );
+
+    software_timer_trace_close(&writer_1);
+    software_timer_trace_close(&reader_1);
+
+    // The records remain in the file
+    assert( software_timer_trace_open(&reader_1, TRACE_PATH) );
+    for(uint32_t index = 1; index <= 4; ++index)
+    {
+        assert( software_timer_trace_next(&reader_1, &record) && index == record.timer_id );
+    }
+    software_timer_trace_close(&reader_1);
+
+    unlink(TRACE_PATH);
+    assert( !software_timer_trace_open(&reader_1, TRACE_PATH) );
+}
+
+static void * writer_thread(void * argument)
+{
+    stress_writer_t * writer = (stress_writer_t *)argument;
+
+    // The deadline counts the records of the writer, the lateness is always one tick
+    for(uint64_t index = 0; index < STRESS_RECORDS + STRESS_EXTRA; ++index)
+    {
+        writer->written += software_timer_trace_record(&writer_1, writer->timer_id, index, index + 1) ? 1 : 0;
+
+        if(0 == index % 16)
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+void software_timer_trace_test_writers()
+{
+    print_function_info(__func__);
+
+    assert( software_timer_trace_create(&writer_1, TRACE_PATH, STRESS_WRITERS * STRESS_RECORDS, &sw_timer_1) );
+    assert( software_timer_trace_open(&reader_1, TRACE_PATH) );
+
+    stress_writer_t writers[STRESS_WRITERS];
+    uint32_t read[STRESS_WRITERS] = { 0 };
+    uint64_t next_deadline[STRESS_WRITERS] = { 0 };
+
+    for(uint32_t index = 0; index < STRESS_WRITERS; ++index)
+    {
+        writers[index].timer_id = index;
+        writers[index].written = 0;
+        assert( 0 == pthread_create(&writers[index].thread, NULL, writer_thread, &writers[index]) );
+    }
+
+    // The reader follows the writers, each record is complete and in the order of its writer
+    software_timer_trace_record_t record;
+
+    for(uint32_t count = 0; count < STRESS_WRITERS * STRESS_RECORDS; )
+    {
+        if(!software_timer_trace_next(&reader_1, &record))
+        {
+            sched_yield();
+            continue;
+        }
+
+        ++count;
+        assert( count == record.sequence );
+        assert( record.timer_id < STRESS_WRITERS && 1 == record.lateness_ticks );
+        assert( record.deadline_ticks >= next_deadline[record.timer_id] );
+        assert( record.deadline_ticks + 1 == record.fire_ticks );
+
+        next_deadline[record.timer_id] = record.deadline_ticks + 1;
+        ++read[record.timer_id];
+    }
+
+    uint32_t written = 0;
+
+    for(uint32_t index = 0; index < STRESS_WRITERS; ++index)
+    {
+        assert( 0 == pthread_join(writers[index].thread, NULL) );
+        assert( read[index] == writers[index].written );
+        written += writers[index].written;
+    }
+
+    assert( STRESS_WRITERS * STRESS_RECORDS == written );
+    assert( STRESS_WRITERS * STRESS_EXTRA == software_timer_trace_dropped(&writer_1) );
+    assert( !software_timer_trace_next(&reader_1, &record) );
+
+    software_timer_trace_close(&writer_1);
+    software_timer_trace_close(&reader_1);
+    unlink(TRACE_PATH);
+}
+
+#endif
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_trace_test(void)
+{
+#if defined(__linux__)
+
+    software_timer_trace_test_record();
+    software_timer_trace_test_tail();
+    software_timer_trace_test_writers();
+
+#endif
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/
@@ -0,0 +1,216 @@
+/*---------------------------------------------------------------------*
+ *  private: include files
+ *---------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <assert.h>
+
+#include "software_timer_virtual.h"
+
+
+/*---------------------------------------------------------------------*
+ *  private: definitions
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: typedefs
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: variables
+ *---------------------------------------------------------------------*/
+
+static software_timer_virtual_t clock_1;
+static software_timer_t * clock_1_timers[4];
+
+static software_timer_timer_info_t sw_timer_1 =
+{
+    .capture_compare = 0xFFFF,
+    .prescaler = 0,
+    .ticks_per_second = 42500000,
+};
+
+static software_timer_t timer_1;
+static software_timer_t timer_2;
+static software_timer_t timer_3;
+
+static uint64_t ticks_1;
+static uint64_t ticks_2;
+static uint64_t ticks_3;
+
+/*---------------------------------------------------------------------*
+ *  public:  variables
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: function prototypes
+ *---------------------------------------------------------------------*/
+/*---------------------------------------------------------------------*
+ *  private: functions
+ *---------------------------------------------------------------------*/
+
+static void print_function_info(const char name[])
+{
+    printf("%s\n", name);
+    fflush(stdout);
+}
+
+static void on_tick_1(software_timer_t * object)
+{
+    (void)object;
+    ++ticks_1;
+}
+
+static void on_tick_2(software_timer_t * object)
+{
+    (void)object;
+    ++ticks_2;
+}
+
+static void on_tick_3(software_timer_t * object)
+{
+    (void)object;
+    ++ticks_3;
+}
+
+
+void software_timer_virtual_test_step()
+{
+    print_function_info(__func__);
+
+    assert( 0 == software_timer_virtual_init(&clock_1, &sw_timer_1, clock_1_timers, 2) );
+    assert( sw_timer_1.counter == &clock_1.counter && sw_timer_1.overflows == &clock_1.overflows );
+    assert( 0 == software_timer_virtual_now(&clock_1) );
+
+    software_timer_init_halt(&timer_1, &sw_timer_1);
+    software_timer_init_halt(&timer_2, &sw_timer_1);
+    software_timer_init_halt(&timer_3, &sw_timer_1);
+
+    assert( software_timer_virtual_register(&clock_1, &timer_1) );
+    assert( software_timer_virtual_register(&clock_1, &timer_2) );
+    assert( !software_timer_virtual_register(&clock_1, &timer_3) );
+
+    // Nothing is running, the time stays
+    assert( UINT64_MAX == software_timer_virtual_step(&clock_1) );
+    assert( 0 == software_timer_virtual_now(&clock_1) );
+
+    software_timer_virtual_advance(&clock_1, 100000);
+    assert( 100000 == software_timer_virtual_now(&clock_1) );
+    assert( 34464 == clock_1.counter && 1 == clock_1.overflows );
+
+    // The clock jumps to the deadline of the earlier timer
+    software_timer_calculate_and_set_duration(&timer_1, 0.001);
+    software_timer_calculate_and_set_duration(&timer_2, 0.0005);
+    software_timer_start(&timer_1);
+    software_timer_start(&timer_2);
+
+    uint64_t deadline = software_timer_get_deadline_ticks(&timer_2);
+    assert( deadline < software_timer_get_deadline_ticks(&timer_1) );
+    assert( deadline == software_timer_virtual_next_deadline(&clock_1) );
+    assert( deadline == software_timer_virtual_step(&clock_1) );
+    assert( deadline == software_timer_virtual_now(&clock_1) );
+    assert( software_timer_elapsed(&timer_2) && !software_timer_elapsed(&timer_1) );
+
+    // A deadline in the past does not move the clock backwards
+    software_timer_virtual_advance(&clock_1, 1000000);
+    uint64_t now = software_timer_virtual_now(&clock_1);
+    assert( software_timer_virtual_step(&clock_1) < now );
+    assert( now == software_timer_virtual_now(&clock_1) );
+
+    assert( software_timer_virtual_unregister(&clock_1, &timer_2) );
+    assert( !software_timer_virtual_unregister(&clock_1, &timer_2) );
+    assert( 1 == clock_1.count && &timer_1 == clock_1_timers[0] );
+    assert( software_timer_get_deadline_ticks(&timer_1) == software_timer_virtual_next_deadline(&clock_1) );
+}
+
+void software_timer_virtual_test_run_until()
+{
+    print_function_info(__func__);
+
+    assert( 0 == software_timer_virtual_init(&clock_1, &sw_timer_1, clock_1_timers, 4) );
+
+    software_timer_init_halt(&timer_1, &sw_timer_1);
+    software_timer_init_halt(&timer_2, &sw_timer_1);
+    software_timer_init_halt(&timer_3, &sw_timer_1);
+    timer_1.on_tick = on_tick_1;
+    timer_2.on_tick = on_tick_2;
+    timer_3.on_tick = on_tick_3;
+
+    assert( software_timer_virtual_register(&clock_1, &timer_1) );
+    assert( software_timer_virtual_register(&clock_1, &timer_2) );
+    assert( software_timer_virtual_register(&clock_1, &timer_3) );
+
+    software_timer_calculate_and_set_duration(&timer_1, 0.001);
+    software_timer_calculate_and_set_duration(&timer_2, 1.0);
+    software_timer_calculate_and_set_duration(&timer_3, 600.0);
+
+    software_timer_start(&timer_1);
+    software_timer_start(&timer_2);
+    software_timer_start(&timer_3);
+
+    ticks_1 = 0;
+    ticks_2 = 0;
+    ticks_3 = 0;
+
+    // One hour at 42.5 MHz
+    uint64_t hour = UINT64_C(3600) * sw_timer_1.ticks_per_second;
+    uint64_t period_1 = timer_1.duration_overflows * sw_timer_1.period + timer_1.duration_counter;
+    uint64_t period_2 = timer_2.duration_overflows * sw_timer_1.period + timer_2.duration_counter;
+
+    uint64_t expired = software_timer_virtual_run_until(&clock_1, hour);
+
+    assert( hour == software_timer_virtual_now(&clock_1) );
+    assert( hour / period_1 == ticks_1 && hour / period_2 == ticks_2 && 6 == ticks_3 );
+    assert( ticks_1 + ticks_2 + ticks_3 == expired );
+    assert( 3600000 <= ticks_1 && 3600 <= ticks_2 );
+    assert( hour < software_timer_virtual_next_deadline(&clock_1) );
+
+    // Without running timers the clock jumps to the end
+    software_timer_stop(&timer_1);
+    software_timer_stop(&timer_2);
+    software_timer_stop(&timer_3);
+    assert( 0 == software_timer_virtual_run_until(&clock_1, 2 * hour) );
+    assert( 2 * hour == software_timer_virtual_now(&clock_1) );
+}
+
+void software_timer_virtual_test_run_until_limits()
+{
+    print_function_info(__func__);
+
+    // Without running timers the simulation ends at once, also at the end of time
+    assert( 0 == software_timer_virtual_init(&clock_1, &sw_timer_1, clock_1_timers, 4) );
+    software_timer_init_halt(&timer_1, &sw_timer_1);
+    assert( software_timer_virtual_register(&clock_1, &timer_1) );
+    assert( 0 == software_timer_virtual_run_until(&clock_1, UINT64_MAX) );
+    assert( UINT64_MAX == software_timer_virtual_now(&clock_1) );
+
+    // A timer without a duration expires once per tick
+    assert( 0 == software_timer_virtual_init(&clock_1, &sw_timer_1, clock_1_timers, 4) );
+    software_timer_init_halt(&timer_1, &sw_timer_1);
+    timer_1.on_tick = on_tick_1;
+    ticks_1 = 0;
+    assert( software_timer_virtual_register(&clock_1, &timer_1) );
+    software_timer_start(&timer_1);
+
+    assert( 11 == software_timer_virtual_run_until(&clock_1, 10) );
+    assert( 11 == ticks_1 );
+    assert( 10 == software_timer_virtual_now(&clock_1) );
+}
+
+
+/*---------------------------------------------------------------------*
+ *  public:  functions
+ *---------------------------------------------------------------------*/
+
+bool software_timer_virtual_test(void)
+{
+    software_timer_virtual_test_step();
+    software_timer_virtual_test_run_until();
+    software_timer_virtual_test_run_until_limits();
+
+    return true;
+}
+
+
+/*---------------------------------------------------------------------*
+ *  eof
+ *---------------------------------------------------------------------*/